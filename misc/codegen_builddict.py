@@ -44,6 +44,140 @@ def fnv1a(data):
         hash_ = ((hash_ ^ c) * 16777619) & 0xffffffff
     return hash_
 
+def hash_tag(tag, seed):
+    """Hash a tag with seed; same as _hash_tag() in datadict.cc."""
+    h = ((tag ^ seed) * 0x9e3779b1) & 0xffffffff
+    h ^= h >> 15
+    h = (h * 0x85ebca77) & 0xffffffff
+    h ^= h >> 13
+    return h
+
+def hash_keyword(keyword, seed):
+    """Hash a keyword with seed; same as _hash_keyword() in datadict.cc."""
+    h = 2166136261 ^ seed
+    for c in bytearray(keyword.encode('ascii')):
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    return h
+
+def build_perfect_hash(keys, hashfn, nbuckets, nslots):
+    """Build a perfect hash (hash and displace) for keys.
+    A key goes to bucket hashfn(key, 0) % nbuckets. Every bucket gets a seed
+    so that hashfn(key, seed) % nslots of keys in the bucket hit empty slots.
+    Returns (seeds, slots); slots hold index of key or -1."""
+    buckets = [[] for _ in range(nbuckets)]
+    for i, key in enumerate(keys):
+        buckets[hashfn(key, 0) & (nbuckets - 1)].append(i)
+
+    seeds = [0] * nbuckets
+    slots = [-1] * nslots
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        items = buckets[b]
+        if not items:
+            break
+        seed = 1
+        while True:
+            pos = [hashfn(keys[i], seed) & (nslots - 1) for i in items]
+            if len(set(pos)) == len(pos) and all(slots[p] < 0 for p in pos):
+                break
+            seed += 1
+            assert seed < 0x10000, 'cannot build perfect hash'
+        seeds[b] = seed
+        for i, p in zip(items, pos):
+            slots[p] = i
+    return seeds, slots
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(' ' + ', '.join(fmt % v for v in values[i:i+per_line]))
+    return ',\n'.join(lines)
+
+def build_tag_hash(tag_list):
+    """Generate tables for TAG lookup in datadict.cc.
+    tag_list: [(tag_str, tag), ...] in the order of element_registry;
+    'x' in tag_str is already replaced with 'f' in tag.
+    - perfect hash of tags -> index of element_registry.
+    - repeating group tags such as (60xx,3000) as (mask, value) pairs."""
+    tags = [tag for tag_s, tag in tag_list]
+    assert len(set(tags)) == len(tags)
+    nbuckets, nslots = 2048, 8192
+    seeds, slots = build_perfect_hash(tags, hash_tag, nbuckets, nslots)
+
+    masked = []
+    for idx, (tag_s, tag) in enumerate(tag_list):
+        if 'x' not in tag_s:
+            continue
+        digits = tag_s[1:5] + tag_s[6:10]
+        mask = int(''.join('0' if c == 'x' else 'f' for c in digits), 16)
+        value = int(''.join('0' if c == 'x' else c for c in digits), 16)
+        masked.append((mask, value, idx, tag_s))
+    masked.sort()
+
+    masks = []  # mask, start, end in tags_xx_values
+    for i, m in enumerate(masked):
+        if not masks or masks[-1][0] != m[0]:
+            masks.append([m[0], i, i])
+        masks[-1][2] = i + 1
+
+    return \
+'''const int SIZE_TAG_HASH_BUCKETS = %d;  // power of 2
+const int SIZE_TAG_HASH_SLOTS = %d;  // power of 2
+const int SIZE_TAGS_XX_MASKS = %d;
+
+// Perfect hash for tags_registry[]; see _find_tag() in datadict.cc.
+static const uint16_t tag_hash_seeds[] = {
+%s
+};
+
+static const int16_t tag_hash_slots[] = {
+%s
+};
+
+// Repeating group tags; 'x' digits are masked out.
+static const uint32_t tags_xx_masks[] = {  // mask, start, end
+%s
+};
+
+static const uint32_t tags_xx_values[] = {  // tag & mask, index
+%s
+};
+''' % (
+        nbuckets, nslots, len(masks),
+        format_array(seeds, '%5d', 12),
+        format_array(slots, '%4d', 16),
+        ',\n'.join(' 0x%08x, %2d, %2d' % tuple(m) for m in masks),
+        ',\n'.join(' /* %s */ 0x%08x, %4d' % (m[3], m[1], m[2]) for m in masked))
+
+def build_keyword_hash(keyword_list):
+    """Generate a perfect hash of keywords -> index of element_registry.
+    keyword_list: [(keyword, idx), ...]"""
+    keywords = [kw for kw, idx in keyword_list]
+    assert len(set(keywords)) == len(keywords)
+    nbuckets, nslots = 2048, 8192
+    seeds, slots = build_perfect_hash(keywords, hash_keyword, nbuckets, nslots)
+    slots = [keyword_list[i][1] if i >= 0 else -1 for i in slots]
+
+    return \
+'''const int SIZE_KEYWORD_HASH_BUCKETS = %d;  // power of 2
+const int SIZE_KEYWORD_HASH_SLOTS = %d;  // power of 2
+
+// Perfect hash for keywords -> index of element_registry[];
+// see TAG::from_keyword() in datadict.cc.
+static const uint16_t keyword_hash_seeds[] = {
+%s
+};
+
+static const int16_t keyword_hash_slots[] = {
+%s
+};
+''' % (
+        nbuckets, nslots,
+        format_array(seeds, '%5d', 12),
+        format_array(slots, '%4d', 16))
+
 def uid2val(uid):
     """uid -> val"""
     val = list(map(int, uid.split('.')[-2:]))
@@ -180,6 +314,8 @@ def build_elements_registry(soup):
     lines = []
     lines_with_x = []
     tags = []
+    tag_list = []
+    keyword_list = []
     keywords = []
 
     min_kw = 10000
@@ -200,10 +336,12 @@ def build_elements_registry(soup):
         lines.append(line)
         line = ' /* %4d */ 0x%08x' % (idx, tag)
         tags.append(line)
+        tag_list.append((tag_s, tag))
 
         if keyword:
             line = '/* %-62s */ %d' % (keyword, idx)
             keywords.append(line)
+            keyword_list.append((keyword, idx))
 
         if 'x' in row[0]:
             line = ' /* %s */ %d' % (tag_s, idx)
@@ -262,6 +400,9 @@ static const int keyword_index[] = {
         ',\n'.join(keywords),
         min_kw, max_kw), file=fout3)
 
+    print(build_tag_hash(tag_list), file=fout3)
+    print(build_keyword_hash(keyword_list), file=fout3)
+
     print('C++ TABLE DONE', file=sys.stderr)
 
     print('write to', DICOMDICT_INC_FILENAME)
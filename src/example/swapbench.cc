@@ -0,0 +1,43 @@
+// Throughput of byte swapping (copyswap2/4/8) versus memcpy.
+#include <dicom.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "util.h"
+
+typedef void (*copy_fn_t)(uint8_t *dst, uint8_t *src, size_t size);
+
+static void memcpy_fn(uint8_t *dst, uint8_t *src, size_t size) {
+  memcpy(dst, src, size);
+}
+
+static double bench(copy_fn_t fn, uint8_t *dst, uint8_t *src, size_t size,
+                    int repeat) {
+  fn(dst, src, size);  // warm up
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeat; i++) fn(dst, src, size);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return (double)size * repeat / elapsed.count() / 1e9;
+}
+
+int main(int argc, char **argv) {
+  // size of buffers in MB; a size of a frame fits in caches if small.
+  size_t size = (argc > 1 ? atoi(argv[1]) : 64) * 1024 * 1024;
+  int repeat = (argc > 2 ? atoi(argv[2]) : 20);
+
+  std::vector<uint8_t> src(size), dst(size);
+  for (size_t i = 0; i < size; i++) src[i] = (uint8_t)i;
+
+  printf("%zu MB x %d\n", size >> 20, repeat);
+  printf("memcpy     %6.2f GB/s\n",
+         bench(memcpy_fn, dst.data(), src.data(), size, repeat));
+  printf("copyswap2  %6.2f GB/s\n",
+         bench(dicom::copyswap2, dst.data(), src.data(), size, repeat));
+  printf("copyswap4  %6.2f GB/s\n",
+         bench(dicom::copyswap4, dst.data(), src.data(), size, repeat));
+  printf("copyswap8  %6.2f GB/s\n",
+         bench(dicom::copyswap8, dst.data(), src.data(), size, repeat));
+}
@@ -8,6 +8,8 @@
 
 #include <stdio.h>
 
+#include <vector>
+
 #include "dicom.h"
 #include "codec_common.h"
 #include "charls_codec.h"
@@ -30,13 +32,14 @@ DICOMSDL_CODEC_RESULT charls_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (ic->datasize < ic->rowstep * ic->rows
-      || ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
+  int rowstep = (ic->rowstep > 0 ? ic->rowstep : -ic->rowstep);
+  if (ic->datasize < (long)rowstep * ic->rows
+      || rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
     snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
              "pixelbuf for decoded image is too small; "
-             "buflen %d < rowstep %d * rows %d or "
-             "rowstep < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
-             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, ic->prec,
+             "buflen %d < |rowstep| %d * rows %d or "
+             "|rowstep| < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
+             int(ic->datasize), rowstep, ic->rows, ic->cols, ic->prec,
              ic->ncomps);
     return DICOMSDL_CODEC_ERROR;
   }
@@ -50,37 +53,58 @@ DICOMSDL_CODEC_RESULT charls_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  std::vector<BYTE> dataUnc;
-  dataUnc.resize(info.bytesperline * info.height);
-
-  error = JpegLsDecode(&dataUnc[0], dataUnc.size(), data, datasize, NULL);
-
-  if (error != OK) {
-    snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
-             "error in JpegLsDecode");
+  if (ic->rows != info.height || ic->cols != info.width ||
+      ic->ncomps != info.components ||
+      (ic->prec > 8 ? 2 : 1) != (info.bitspersample > 8 ? 2 : 1)) {
+    snprintf(ic->info, ARGBUF_SIZE, "error: info mismatch "
+             "DICOM info (%d x %d, %d bits, %d planes) != "
+             "JPEGLS info (%d x %d, %d bits, %d planes)",
+             ic->cols, ic->rows, ic->prec, ic->ncomps, info.width,
+             info.height, info.bitspersample, info.components);
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (ic->rows != info.height || ic->cols != info.width) {
-    snprintf(ic->info, ARGBUF_SIZE, "error: info mismatch "
-             "DICOM info (%d x %d) != JPEGLS info (%d x %d)",
-             ic->cols, ic->rows, info.width, info.height);
-    return DICOMSDL_CODEC_ERROR;
+  int bytespersample = (info.bitspersample > 8 ? 2 : 1);
+  info.outputBgr = 0;
+
+  if (info.ilv != ILV_NONE || info.components == 1) {
+    // CharLS writes each row at `bytesperline` bytes from the previous row,
+    // so rows are decoded straight into the caller's buffer.
+    uint8_t *q = (uint8_t *)ic->data;
+    if (ic->rowstep < 0)
+      q += (size_t)rowstep * (ic->rows - 1);
+    info.bytesperline = ic->rowstep;
+    error = JpegLsDecode(q, (size_t)rowstep * ic->rows, data, datasize,
+                         &info);
+  } else {
+    // a scan per component is decoded into planes RRR..GGG..BBB..; then
+    // samples are interleaved.
+    size_t planesize = (size_t)info.width * info.height * bytespersample;
+    std::vector<BYTE> planes(planesize * info.components);
+    info.bytesperline = info.width * bytespersample;
+    error = JpegLsDecode(&planes[0], planes.size(), data, datasize, &info);
+
+    uint8_t *q = (uint8_t *)ic->data;
+    if (ic->rowstep < 0)
+      q += (size_t)rowstep * (ic->rows - 1);
+    int pixelsize = bytespersample * info.components;
+    for (int k = 0; error == OK && k < info.components; k++) {
+      const uint8_t *p = &planes[planesize * k];
+      uint8_t *row = q + k * bytespersample;
+      for (int j = 0; j < ic->rows; j++, row += ic->rowstep) {
+        for (int i = 0; i < ic->cols; i++, p += bytespersample)
+          memcpy(row + i * pixelsize, p, bytespersample);
+      }
+    }
   }
 
-  int rowstep = (ic->rowstep > 0 ? ic->rowstep : -ic->rowstep);
-  int bytesperline = (rowstep > info.bytesperline ? info.bytesperline : rowstep);
-
-  uint8_t *q;
-  if (ic->rowstep > 0)
-    q = (uint8_t *) (ic->data);
-  else
-    q = (uint8_t*) (ic->data + (ic->rows - 1) * (-ic->rowstep));
-  for (int j = 0; j < ic->rows; j++) {
-    memcpy(q, &dataUnc[info.bytesperline * j], bytesperline);
-    q += ic->rowstep;
+  if (error != OK) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
+             "error in JpegLsDecode (%d)", int(error));
+    return DICOMSDL_CODEC_ERROR;
   }
 
+  ic->lossy = (info.allowedlossyerror > 0 ? 1 : 0);
   return DICOMSDL_CODEC_OK;
 }
 
@@ -95,27 +119,123 @@ DICOMSDL_CODEC_RESULT charls_encoder(const char *tsuid, imagecontainer *ic,
     return DICOMSDL_CODEC_NOTSUPPORTED;
 
   if (data == NULL|| datasize == 0|| free_memory_fn == NULL) {
-    snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
              "data or datasize or free_memory_fn is NULL.");
     return DICOMSDL_CODEC_ERROR;
   }
 
+  *data = NULL;
+  *datasize = 0;
   *free_memory_fn = charls_codec_free_memory;
 
-  /*
-   * { do encode pixel data }
-   * *datasize = { encoded data size }
-   * *data = (char *)malloc(*datasize);
-   * { store encoded data to *data }
-   * free_memory_fn = dummy_codec_free_memory;
-   * return
-   */
+  // near=n for maximum error n of near-lossless compression (.81 only).
+  // planar=1 if components are stored in planes RRR..GGG..BBB.. without
+  // padding between rows and planes; up to 12 bits.
+  int near = 0;
+  int planar = 0;
+  argparser p(ic);
+  int key;
+  while ((key = p.get_next_argkey()) > 0) {
+    switch (key) {
+      case ARGKEY_NEAR:
+        near = p.value_as_int();
+        break;
+      case ARGKEY_PLANAR:
+        planar = (p.value_as_int() != 0);
+        break;
+      default:
+        break;
+    }
+  }
+  if (key != 0)  // argument key error, error message in ic->info
+    return DICOMSDL_CODEC_ERROR;
 
-  *data = NULL;
-  *datasize = 0;
+  bool lossless = (strcmp("1.2.840.10008.1.2.4.80", tsuid) == 0);
+  if (near < 0 || near > 255 || (lossless && near != 0)) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "near=%d is not allowed for %s.", near,
+             lossless ? "JPEG-LS Lossless" : "JPEG-LS Near-Lossless");
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  if (ic->prec < 6 || ic->prec > 16 ||
+      (ic->ncomps != 1 && ic->ncomps != 3)) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "unsupported image format - %d bits and %d planes.",
+             ic->prec, ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // CharLS writes a stream that it cannot decode for components of more
+  // than 12 bits in separate scans (ILV_NONE).
+  if (planar && ic->ncomps > 1 && ic->prec > 12) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "planar=1 is not supported for %d bits and %d planes.",
+             ic->prec, ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  int bytespersample = (ic->prec > 8 ? 2 : 1);
+  int rowstep = (ic->rowstep > 0 ? ic->rowstep : -ic->rowstep);
+  int rowbytes = ic->cols * bytespersample * (planar ? 1 : ic->ncomps);
+  int nplanes = (planar ? ic->ncomps : 1);
+  if (!ic->data || ic->rows <= 0 || ic->cols <= 0 || rowstep < rowbytes ||
+      ic->datasize < (long)rowstep * ic->rows * nplanes ||
+      (planar && ic->ncomps > 1 && ic->rowstep != rowbytes)) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "pixelbuf is too small or has unsupported layout; "
+             "buflen %d, rowstep %d, rows %d, cols %d, prec %d, ncomps %d",
+             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, ic->prec,
+             ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // CharLS reads rows of `bytesperline` bytes from the caller's buffer, so
+  // pixels are encoded in place. DICOM does not allow color transforms.
+  JlsParameters params = JlsParameters();
+  params.width = ic->cols;
+  params.height = ic->rows;
+  params.bitspersample = ic->prec;
+  params.components = ic->ncomps;
+  params.bytesperline = ic->rowstep;
+  params.allowedlossyerror = near;
+  params.ilv = (ic->ncomps == 1 || planar ? ILV_NONE : ILV_SAMPLE);
+  params.colorTransform = 0;
+
+  const char *src = ic->data;
+  if (ic->rowstep < 0)
+    src += (size_t)rowstep * (ic->rows - 1);
+
+  // JPEG-LS may be a bit larger than raw pixels for noisy images.
+  size_t rawsize = (size_t)rowbytes * ic->rows * nplanes;
+  size_t bufsize = rawsize + rawsize / 2 + 1024;
+  char *buf = (char *)malloc(bufsize);
+  if (!buf) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "cannot allocate %d bytes.", int(bufsize));
+    return DICOMSDL_CODEC_ERROR;
+  }
 
-  snprintf(ic->info, ARGBUF_SIZE, "DUMMY ENCODER");
-  return DICOMSDL_CODEC_ERROR;
+  size_t written = 0;
+  JLS_ERROR error;
+  try {
+    error = JpegLsEncode(buf, bufsize, &written, src,
+                         (size_t)rowstep * ic->rows * nplanes, &params);
+  } catch (JlsException &e) {
+    error = e._error;
+  }
+  if (error != OK) {
+    free(buf);
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "error in JpegLsEncode (%d)", int(error));
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  char *shrunk = (char *)realloc(buf, written);
+  *data = (shrunk ? shrunk : buf);
+  *datasize = (long)written;
+  ic->lossy = (near > 0 ? 1 : 0);
+  return DICOMSDL_CODEC_OK;
 }
 
 extern "C" void charls_codec_free_memory(char *data) {
@@ -16,6 +16,8 @@
 #define ARGKEY_REVERSIBLE 6 /* reversible */
 #define ARGKEY_MODE 7 /* mode */
 #define ARGKEY_QUALITY 8 /* quality */
+#define ARGKEY_PLANAR 9 /* planar */
+#define ARGKEY_NEAR 10 /* near */
 
 static int __stricmp(const char *a, const char *b)
 {
@@ -27,6 +29,7 @@ static int get_argkey(char *arg) {
 	int key=0;
 	switch (*c++) {
 		case 'm': case 'M': key=ARGKEY_MODE; goto L_EXIT; break;
+		case 'n': case 'N': key=ARGKEY_NEAR; goto L_EXIT; break;
 		case 'l': case 'L': {
 			switch (*c++) {
 				case 'a': case 'A': key=ARGKEY_LAYER; goto L_EXIT; break;
@@ -35,7 +38,13 @@ static int get_argkey(char *arg) {
 			};
 		}; break;
 		case 'q': case 'Q': key=ARGKEY_QUALITY; goto L_EXIT; break;
-		case 'p': case 'P': key=ARGKEY_PRECISE; goto L_EXIT; break;
+		case 'p': case 'P': {
+			switch (*c++) {
+				case 'l': case 'L': key=ARGKEY_PLANAR; goto L_EXIT; break;
+				case 'r': case 'R': key=ARGKEY_PRECISE; goto L_EXIT; break;
+				default: goto L_EXIT; break;
+			};
+		}; break;
 		case 's': case 'S': key=ARGKEY_STEP; goto L_EXIT; break;
 		case 'r': case 'R': {
 			switch (*c++) {
@@ -56,6 +65,8 @@ L_EXIT:
 		case ARGKEY_REVERSIBLE: if (__stricmp(arg, "reversible")) return 0; break;
 		case ARGKEY_MODE: if (__stricmp(arg, "mode")) return 0; break;
 		case ARGKEY_QUALITY: if (__stricmp(arg, "quality")) return 0; break;
+		case ARGKEY_PLANAR: if (__stricmp(arg, "planar")) return 0; break;
+		case ARGKEY_NEAR: if (__stricmp(arg, "near")) return 0; break;
 		default: break;
 	}
 	return key;
@@ -11,8 +11,10 @@
 
 #include <string.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,9 +26,11 @@ namespace dicom {
 class DataSet;
 class DataElement;
 class InStream;
+class OutStream;
 class Sequence;
 class PixelSequence;
 class DicomException;
+class Arena;
 
 // Types -======================================================================
 
@@ -91,6 +95,8 @@ struct TAG {
   static const char* keyword(tag_t tag); // Tag::keyword(tag)
   static const char* name(tag_t tag); // Tag::name(tag)
   static tag_t from_keyword(const char* keyword); // Tag::from_keyword(string)
+  // `keyword` need not be null-terminated.
+  static tag_t from_keyword(const char* keyword, size_t size);
 };
 
 // UID -----------------------------------------------------------------------
@@ -326,12 +332,26 @@ void Buffer<T>::free() {
   owndata = false;
 }
 
+// Arena =======================================================================
+
+// DataElements, Sequences, PixelSequences, child DataSets and PixelFrames are
+// allocated from the Arena of the root DataSet. Their destructors are called
+// by `ArenaDelete`; memory is released all at once with the root DataSet.
+template <typename T>
+struct ArenaDelete {
+  inline void operator()(T* p) const { p->~T(); }
+};
+template <typename T>
+using arena_ptr = std::unique_ptr<T, ArenaDelete<T>>;
+
 // DataElement =================================================================
 
+// Thread safety: same as the root DataSet which owns this DataElement.
 class DataElement {
  public:
   tag_t tag_;
   vr_t vr_;
+  bool arena_value_;  // `ptr_` is allocated from the Arena.
   size_t length_;
   size_t offset_;  // value offset in the stream.
   union {  // hold binary data or sequence or pixel sequence.
@@ -431,7 +451,7 @@ class DataElement {
  private:
   // Allocate size bytes memory to `ptr_`. `_free_ptr()` set `ptr_` to
   // `nullptr` if size is zero. `length_` is set to size. `size` should be
-  // even.
+  // even. Short values are taken from the Arena of the root DataSet.
   void alloc_ptr_(size_t size);
   // Free memory if `ptr_` is not null. `ptr_` is set to `nullptr`.
   void _free_ptr();
@@ -448,24 +468,57 @@ class DataElement {
 
 // DataSet =====================================================================
 
+// Thread safety: different DataSets may be used from different threads at the
+// same time. Many threads may read elements and values of one DataSet at the
+// same time; lazy loading of elements after `load_until` and reading values
+// from the InStream are synchronized internally. Functions that change a
+// DataSet (add/remove/set values, attach, save with metainfo...) should not be
+// called while other threads use the DataSet.
 class DataSet {
+ public:
+  // Elements sorted by tag. Elements are appended while parsing a file since
+  // tags come in ascending order; other tags are inserted in place.
+  typedef std::vector<std::pair<tag_t, arena_ptr<DataElement>>>
+      element_table_t;
+
+ private:
   DataSet *root_dataset_;
 
-  std::map<tag_t, std::unique_ptr<DataElement>> edict_;
+  // Declared before `edict_` so that the Arena outlives the elements.
+  std::unique_ptr<Arena> arena_owner_;  // only in the root DataSet
+  Arena* arena_;  // Arena of the root DataSet
+
+  element_table_t edict_;
   std::unique_ptr<InStream> is_;
 
-  tag_t last_tag_loaded_;
+  // Elements up to this tag are loaded. 0xffffffff if the DataSet is fully
+  // loaded, then elements are looked up without locking.
+  std::atomic<tag_t> last_tag_loaded_;
+  std::recursive_mutex load_mutex_;  // guards lazy loading in root DataSet
   uint8_t buf8_[8];  // temporary buffer for tag, vr and length
 
   tsuid_t transfer_syntax_;
 
-  // first character set for convert_to_unicode argument
-  charset_t specific_charset0_;
+  // first character set for convert_to_unicode argument. UNKNOWN until
+  // (0008,0005) is parsed under `load_mutex_`; `specific_charset1_` is valid
+  // once this is set.
+  std::atomic<charset_t> specific_charset0_;
   // last character set for convert_from_unicode argument
   charset_t specific_charset1_;
 
   size_t offset_in_stream_;  // location in the file (for DICOMDIR)
 
+  // Sorted tags to load in the root DataSet; all tags if empty.
+  std::vector<tag_t> load_tags_;
+  bool _is_tag_to_load(tag_t tag) const;
+
+  // first element in `edict_` whose tag is not less than `tag`.
+  element_table_t::iterator _lower_bound(tag_t tag);
+
+  // write the DataSet as a DICOM file into `os`; used by saveTo*().
+  void _saveTo(OutStream& os);
+
+  friend class Sequence;  // takes `load_mutex_` of the root DataSet
  public:
   DataSet();
   DataSet(DataSet* parent);
@@ -489,13 +542,24 @@ class DataSet {
   void removeDataElement(const char *tagstr);
 
   void attachToMemory(const uint8_t* data, size_t datasize, bool copy_data);
-  void attachToFile(const char* filename);
+  // use_mmap: map the whole file into memory instead of reading it in
+  //           growing chunks (InMmapStream).
+  void attachToFile(const char* filename, bool use_mmap = false);
   void attachToInstream(InStream *basestream, size_t size);
-  void detach();  /// delete InFileStream or InMemoryStream object
+  // delete InFileStream or InMemoryStream object; values and sequence items
+  // which are not read from it yet should not be accessed after this.
+  void detach();
 
   void load(tag_t load_until, InStream *instream);
   void loadDicomFile(tag_t load_until);
 
+  // Load only data elements with these tags in the root DataSet; others are
+  // skipped by their length without creating DataElements. A sequence is
+  // loaded with all of its items if its tag is in `tags`. File meta
+  // information (0002,xxxx), SpecificCharacterSet and BitsAllocated are always
+  // loaded. Should be called before loadDicomFile().
+  void setLoadTags(const std::vector<tag_t>& tags);
+
   // Config::set("SAVE_SQ_EXPLICIT_LENGTH", "TRUE")
   // Config::set("SAVE_SQ_EXPLICIT_LENGTH", "FALSE")
   // - Write explicit length of Sequence and its DataSet items if "TRUE".
@@ -505,13 +569,31 @@ class DataSet {
   // Config::set("WRITE_PREAMBLE", "TRUE")
   // Config::set("WRITE_PREAMBLE", "FALSE")
   // - Write preamble 132 bytes (128 '\0's and "DICM") if "TRUE".
+  // Config::setInteger("DEFLATE_LEVEL", 6)
+  // Config::setInteger("DEFLATE_THREADS", 0)
+  // - Compression level (0-9) and number of threads (number of cores if 0)
+  //   to deflate data elements if TransferSyntaxUID is Deflated Explicit VR
+  //   Little Endian.
+  //
+  // A file is written from the beginning to the end, so `oss` and `fd` need
+  // not be seekable (e.g. pipes or sockets). Values that were not read yet
+  // are copied from the file this DataSet is read from while writing, so
+  // neither may write to that file; use saveToFile() for it.
   void saveToStream(std::ostream& oss);
+  // `filename` may be the file this DataSet is read from; then a new file is
+  // written next to it and moved to `filename`. On Windows the rest of the
+  // old file is read into memory before the move, and the move may fail if
+  // the DataSet was opened with `use_mmap`; `filename` is kept then.
   void saveToFile(const char *filename);
+  // write with writev() on POSIX systems. `fd` should not be the file this
+  // DataSet is read from, which throws.
+  void saveToFd(int fd);
   std::string saveToMemory();
 
   void close();
 
   inline InStream* instream() { return is_.get(); }
+  inline Arena* arena() { return arena_; }
 
   inline bool isExplicitVr() const {
     return transfer_syntax_ != UID::IMPLICIT_VR_LITTLE_ENDIAN;
@@ -532,10 +614,10 @@ class DataSet {
   inline size_t getOffset() { return offset_in_stream_; }
   inline void setOffset(size_t offset) { offset_in_stream_ = offset; }
 
-  inline decltype(edict_)::iterator begin() {
+  inline element_table_t::iterator begin() {
     return edict_.begin();
   }
-  inline decltype(edict_)::iterator end() {
+  inline element_table_t::iterator end() {
     return edict_.end();
   }
   
@@ -546,23 +628,138 @@ class DataSet {
 
 // if keep_on_error is true, ignore exception and return partially decoded
 // DataSet.
+// if use_mmap is true, the file is memory mapped rather than read.
 std::unique_ptr<DataSet> open_file(const char* filename,
                                    tag_t load_until = 0xffffffff,
-                                   bool keep_on_error = false);
+                                   bool keep_on_error = false,
+                                   bool use_mmap = false);
+// Load only data elements with `tags`; see DataSet::setLoadTags().
+// Loading stops after the largest tag in `tags`.
+std::unique_ptr<DataSet> open_file(const char* filename,
+                                   const std::vector<tag_t>& tags,
+                                   bool keep_on_error = false,
+                                   bool use_mmap = false);
 std::unique_ptr<DataSet> open_memory(const uint8_t* data, size_t datasize,
                                      bool copy_data = true,
                                      tag_t load_until = 0xffffffff,
                                      bool keep_on_error = false);
 
+// Open files in parallel with `nthreads` threads (number of cores if
+// `nthreads` <= 0). DataSets are returned in the order of `filenames`.
+// A file that failed to load gives nullptr, or a partially decoded DataSet if
+// keep_on_error is true; if `errors` is given, errors->at(i) holds the error
+// message for filenames[i] (empty if successful).
+std::vector<std::unique_ptr<DataSet>> open_files(
+    const std::vector<std::string>& filenames, tag_t load_until = 0xffffffff,
+    int nthreads = 0, bool keep_on_error = false,
+    std::vector<std::string>* errors = nullptr);
+
+// Read data elements before `stop_tag` with as few bytes as possible, for
+// indexing metadata of many files.
+// - Values longer than INSTREAM_SHORT_VALUE_LENGTH (e.g. pixel data before
+//   `stop_tag`) are recorded as offset and length only and never read.
+// - No byte after the tag, vr and length of `stop_tag` is read.
+// - If `max_bytes` is not zero, no byte at or after `max_bytes` is read
+//   while parsing; a header that doesn't fit in it is returned partially,
+//   and the element cut by `max_bytes`, if any, is the last one. Errors
+//   before `max_bytes` (e.g. a value longer than the file) are still thrown.
+// - Number of bytes read from the file is stored in `bytes_read`.
+// Values that were not read, including the one cut by `max_bytes`, are read
+// from the file when they are accessed.
+std::unique_ptr<DataSet> scan_header(const char* filename,
+                                     tag_t stop_tag = 0x7fe00010,
+                                     size_t max_bytes = 0,
+                                     size_t* bytes_read = nullptr);
+
+// TagPath =====================================================================
+
+// A tag string for DataSet::getDataElement(const char*), e.g.
+// "52009229.0.00289110.0.00280030", "(0009,{CREATOR}10)" or
+// "SharedFunctionalGroupsSequence.0.PixelMeasuresSequence.0.PixelSpacing",
+// parsed once and evaluated against many DataSets.
+// '*' in place of an item index, e.g. "52009230.*.00289145.0.00281052",
+// matches every item of the sequence; see forEach().
+// Block of a private creator is looked up in each DataSet, but the block found
+// last time is tried first.
+// Thread safety: find() may be called from several threads at the same time.
+class TagPath {
+ public:
+  struct Step {
+    tag_t tag;            // gggg00ee if `creator` is not empty.
+    std::string creator;  // private creator, e.g. "CREATOR" for
+                          // "0009,{CREATOR}10".
+    int index;            // item index in the sequence; LAST for the last
+                          // step, ANY for '*'.
+    mutable std::atomic<uint8_t> block;  // block found last time
+
+    Step(tag_t tag, const std::string& creator);
+    Step(const Step& other);
+  };
+
+ private:
+  std::string tagstr_;
+  std::vector<Step> steps_;
+
+  // Tag of the step in `dataset`; 0xffffffff if the private creator is not in
+  // `dataset`.
+  tag_t _resolve(const Step& step, DataSet* dataset) const;
+  void _forEach(size_t i, DataSet* dataset,
+                const std::function<void(DataElement*)>& fn) const;
+
+ public:
+  enum { LAST = -1, ANY = -2 };
+
+  TagPath(const char* tagstr);
+
+  // Returns DataElement::NullElement() if there is no element for the path.
+  // '*' is taken as the first item.
+  DataElement* find(DataSet* dataset) const;
+
+  // Call `fn` for every element matching the path, in the order of items.
+  // For an item where the rest of the path is not found, `fn` is called with
+  // DataElement::NullElement(), so that results line up with the items.
+  void forEach(DataSet* dataset,
+               const std::function<void(DataElement*)>& fn) const;
+
+  // Append the value of every element matching the path to `values`;
+  // `default_value` for missing elements or elements without value.
+  void toDoubleVector(DataSet* dataset, std::vector<double>& values,
+                      double default_value = 0.0) const;
+  void toLongVector(DataSet* dataset, std::vector<long>& values,
+                    long default_value = 0) const;
+
+  inline const std::string& str() const { return tagstr_; }
+  inline const std::vector<Step>& steps() const { return steps_; }
+};
+
 
 // Sequence ====================================================================
 
+// Thread safety: same as the root DataSet which owns this Sequence.
+// Items of a Sequence read from a file are parsed on first access; the first
+// access locks the root DataSet's load lock. If parsing items fails,
+// size(), begin(), end(), getDataSet() and addDataSet() throw DicomException
+// with the same message on every call, not only on the first one.
 class Sequence {
   DataSet* root_dataset_;
 
   tsuid_t transfer_syntax_;
 
-  std::vector<std::unique_ptr<DataSet>> seq_;
+  std::vector<arena_ptr<DataSet>> seq_;
+
+  // Location of items which are not parsed yet; see setDeferredLoad().
+  InStream* instream_;
+  size_t offset_, length_;
+  std::atomic<bool> loaded_;
+  // Error while parsing items; set before `loaded_`.
+  std::string load_error_;
+
+  void _load_items();
+  inline void _ensure_loaded() {
+    if (!loaded_.load(std::memory_order_acquire) || !load_error_.empty())
+      _load_items();
+  }
+  DataSet* _add_dataset();
 
  public:
   Sequence(DataSet* root_dataset);
@@ -571,17 +768,25 @@ class Sequence {
   Sequence(const Sequence&&) = delete;
 
   void load(InStream* instream);
+  // Parse items in `length` bytes from `offset` of `instream` on first access
+  // rather than now. `instream` should live until then.
+  void setDeferredLoad(InStream* instream, size_t offset, size_t length);
 
-  inline int size() { return (int)seq_.size(); }
+  inline int size() {
+    _ensure_loaded();
+    return (int)seq_.size();
+  }
 
   DataSet* addDataSet();              // wrapper
   DataSet* getDataSet(size_t index);  // wrapper
   DataSet* operator[](size_t index);
 
   inline decltype(seq_)::iterator begin() {
+    _ensure_loaded();
     return seq_.begin();
   }
   inline decltype(seq_)::iterator end() {
+    _ensure_loaded();
     return seq_.end();
   }
 
@@ -624,8 +829,11 @@ struct PixelFrame {
   size_t encodedDataSize() { return encoded_data_size_; };
 };
 
+// Thread safety: same as the root DataSet which owns this PixelSequence.
+// decodeFrames() uses several threads internally but touches the InStream
+// only from the calling thread.
 class PixelSequence {
-  std::vector<std::unique_ptr<PixelFrame>> frames_;
+  std::vector<arena_ptr<PixelFrame>> frames_;
   std::unique_ptr<InStream> is_;  // InSubStream
 
   DataSet *root_dataset_;
@@ -649,6 +857,7 @@ class PixelSequence {
   inline decltype(frames_)::iterator begin() { return frames_.begin(); }
   inline decltype(frames_)::iterator end() { return frames_.end(); }
   inline InStream* instream() { return is_.get(); }
+  inline DataSet* rootDataSet() { return root_dataset_; }
 
   inline size_t numberOfFrames() const { return frames_.size(); }
 
@@ -662,8 +871,29 @@ class PixelSequence {
   void copyDecodedFrameData(size_t index, uint8_t* data, int datasize,
                             int rowstep);
 
+  // Decode `count` frames from `start` into `data` with `nthreads` threads
+  // (number of cores if `nthreads` <= 0). Frame i is stored at
+  // data + i * rows * rowstep; `datasize` should be count * rows * rowstep.
+  // If `errors` is null, an exception is thrown when any frame fails;
+  // otherwise errors->at(i) holds the error message of frame `start + i`
+  // (empty if successful).
+  void decodeFrames(size_t start, size_t count, uint8_t* data,
+                    size_t datasize, int rowstep, int nthreads = 0,
+                    std::vector<std::string>* errors = nullptr);
+
   void setEncodedFrameData(size_t index, uint8_t* data, size_t datasize);
 
+  // Encode a frame in `data` with the transfer syntax of this sequence and
+  // set it to frame `index` with setEncodedFrameData(). `data` holds `rows`
+  // rows of `rowstep` bytes, as copyDecodedFrameData() stores; `args` is
+  // passed to the encoder in "key=value;..." form. With "planar=1", the RLE
+  // encoder takes components in planes of rows * rowstep bytes each.
+  // Config::setInteger("RLE_THREADS", 0)
+  // - Number of threads (number of cores if 0) to encode RLE segments of a
+  //   large frame.
+  void encodeFrameData(size_t index, uint8_t* data, size_t datasize,
+                       int rowstep, const char* args = "");
+
   Buffer<uint8_t> encodedFrameData(size_t index);
   size_t encodedFrameDataSize(size_t index);
 };
@@ -675,6 +905,8 @@ struct PixelSequenceItem {
 };
 
 // load/unload codec for encoding/decoding pixels
+// Thread safety: don't call these while other threads encode or decode
+// pixels; encode_pixeldata() and decode_pixeldata() may run concurrently.
 void load_codec(char *codec_filename);
 void unload_codec(char *codec_filename);
 
@@ -703,8 +935,10 @@ DicomException build_exception(const char* m, ...);
   } while (0);
 
 
-// PixelSequence ===============================================================
+// Config ======================================================================
 
+// Thread safety: set() and setInteger() should not be called while other
+// threads use the library; concurrent get() and getInteger() are safe.
 class Config {
   std::map<std::string, std::string> dict_;
 
@@ -753,6 +987,10 @@ struct LogLevel {
 
 typedef std::function<void(LogLevel::type, const char*)> LoggerFunctionType;
 
+// Thread safety: log messages may be sent from any thread, including worker
+// threads of open_files() and PixelSequence::decodeFrames(); the logger
+// function should be thread safe. Set it before starting other threads.
+
 void set_loglevel(LogLevel::type loglevel);
 LogLevel::type get_loglevel();
 void set_logger_function(LoggerFunctionType& logfunc);
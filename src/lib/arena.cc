@@ -0,0 +1,59 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * arena.cc
+ */
+
+#include <stdlib.h>
+
+#include "arena.h"
+#include "dicom.h"
+
+namespace dicom {
+
+Arena::Arena()
+    : cur_(nullptr),
+      remaining_(0),
+      next_block_size_(ARENA_MIN_BLOCK_SIZE),
+      capacity_(0) {}
+
+Arena::~Arena() { reset(); }
+
+void* Arena::allocate_block(size_t size, size_t align) {
+  size_t block_size = next_block_size_;
+  if (size + align > block_size / 4) {
+    // large request gets a block of its own; keep the current block.
+    char* block = (char*)::malloc(size + align);
+    if (!block)
+      LOGERROR_AND_THROW("Arena::allocate - cannot allocate %zd bytes.", size);
+    blocks_.push_back(block);
+    capacity_ += size + align;
+    size_t pad = (align - ((size_t)block & (align - 1))) & (align - 1);
+    return block + pad;
+  }
+
+  char* block = (char*)::malloc(block_size);
+  if (!block)
+    LOGERROR_AND_THROW("Arena::allocate - cannot allocate %zd bytes.",
+                       block_size);
+  blocks_.push_back(block);
+  capacity_ += block_size;
+  if (next_block_size_ < ARENA_MAX_BLOCK_SIZE) next_block_size_ *= 2;
+
+  cur_ = block;
+  remaining_ = block_size;
+  return allocate(size, align);
+}
+
+void Arena::reset() {
+  for (auto block : blocks_) ::free(block);
+  blocks_.clear();
+  cur_ = nullptr;
+  remaining_ = 0;
+  next_block_size_ = ARENA_MIN_BLOCK_SIZE;
+  capacity_ = 0;
+}
+
+}  // namespace dicom
@@ -0,0 +1,78 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * arena.h
+ */
+
+#ifndef DICOMSDL_ARENA_H__
+#define DICOMSDL_ARENA_H__
+
+#include <stddef.h>
+
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dicom {
+
+// Size of the first block; later blocks double up to ARENA_MAX_BLOCK_SIZE.
+#define ARENA_MIN_BLOCK_SIZE 4096
+#define ARENA_MAX_BLOCK_SIZE 65536
+// Values up to this size set by DataElement are kept in the Arena. Setting a
+// value again leaves the old one in the Arena, so long values use malloc.
+#define DATAELEMENT_ARENA_VALUE_LENGTH 256
+
+// Monotonic allocator owned by a root DataSet.
+// DataElements, Sequences, PixelSequences, child DataSets, PixelFrames and
+// short values are carved out of a few large blocks instead of being
+// malloc'ed one by one. Memory is never returned piece by piece; all blocks
+// are freed at once by reset() or when the Arena is destroyed.
+// Objects created by `create()` should be destroyed by `ArenaDelete` (which
+// only calls the destructor) before the Arena goes away.
+// Not thread safe; callers hold the root DataSet's load lock or own the
+// DataSet exclusively.
+class Arena {
+  std::vector<char*> blocks_;
+  char* cur_;         // next free byte in the last block
+  size_t remaining_;  // free bytes in the last block
+  size_t next_block_size_;
+  size_t capacity_;  // total bytes of blocks
+
+  void* allocate_block(size_t size, size_t align);
+
+ public:
+  Arena();
+  ~Arena();
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // Return `size` bytes aligned to `align` (power of two). Throws on failure.
+  inline void* allocate(size_t size, size_t align = sizeof(void*) * 2) {
+    size_t pad = (align - ((size_t)cur_ & (align - 1))) & (align - 1);
+    if (pad + size <= remaining_) {
+      void* p = cur_ + pad;
+      cur_ += pad + size;
+      remaining_ -= pad + size;
+      return p;
+    }
+    return allocate_block(size, align);
+  }
+
+  template <typename T, typename... Args>
+  inline T* create(Args&&... args) {
+    return new (allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+  }
+
+  // Free every block. Objects in the arena should be destroyed already.
+  void reset();
+
+  // Total bytes of blocks held by the arena.
+  inline size_t capacity() const { return capacity_; }
+};
+
+}  // namespace dicom
+
+#endif  // DICOMSDL_ARENA_H__
@@ -26,11 +26,22 @@ typedef struct _element_registry_struct_ {
  const int SIZE_ELEMENT_REGISTRY = 4206;
  const int SIZE_INDEX_TAGS_WITH_XX = 88;
  const int SIZE_INDEX_KEYWORD = 4202;
+ const int SIZE_TAG_HASH_BUCKETS = 2048;
+ const int SIZE_TAG_HASH_SLOTS = 8192;
+ const int SIZE_TAGS_XX_MASKS = 5;
+ const int SIZE_KEYWORD_HASH_BUCKETS = 2048;
+ const int SIZE_KEYWORD_HASH_SLOTS = 8192;
 
  static const ElementRegistry element_registry[] = {}
  static const tag_t tags_registry[] = {}
  static const int tags_xx_index[] = {}
  static const int keyword_index[] = {}
+ static const uint16_t tag_hash_seeds[] = {}
+ static const int16_t tag_hash_slots[] = {}
+ static const uint32_t tags_xx_masks[] = {}
+ static const uint32_t tags_xx_values[] = {}
+ static const uint16_t keyword_hash_seeds[] = {}
+ static const int16_t keyword_hash_slots[] = {}
  */
 
 // -----------------------------------------------------------------------------
@@ -140,61 +151,43 @@ const char *UID::uidvalue_to_uidname(const char *uidvalue) {
 
 // -----------------------------------------------------------------------------
 
-static int _compare_tag_xx(const char *a, char *b) {
-  while (*a) {
-    if (*a == 'x' || *a == *b) {
-      a++;
-      b++;
-    } else {
-      if (*a > *b) return 1;
-      if (*a < *b) return -1;
-    }
-  }
-  return 0;
+static inline uint32_t _hash_tag(tag_t tag, uint32_t seed) {
+  // same as hash_tag() in 'misc/codegen_builddict.py'
+  uint32_t h = (tag ^ seed) * 0x9e3779b1u;
+  h ^= h >> 15;
+  h *= 0x85ebca77u;
+  h ^= h >> 13;
+  return h;
 }
 
 // Search a Tag from Element Registry
 static ElementRegistry *_find_tag(tag_t key) {
-  int imin, imax;
-
-  // Try find key from 'tag_t tags_registry[]'
-
-  imin = 0;
-  imax = SIZE_ELEMENT_REGISTRY - 1;
-  while (imin < imax) {
-    int imid = (imin + imax) / 2;
-
-    if (tags_registry[imid] < key)
-      imin = imid + 1;
-    else
-      imax = imid;
-  }
-
-  if ((imax == imin) && (tags_registry[imin] == key))
-    return (ElementRegistry *)element_registry + imin;
-
-  // Try find key from 'int tags_xx_index[]'
-
-  imin = 0;
-  imax = SIZE_INDEX_TAGS_WITH_XX - 1;
-  char key_str[16];
-  sprintf(key_str, "(%04x,%04x)", TAG::group(key), TAG::element(key));
-
-  while (imin < imax) {
-    int imid = (imin + imax) / 2;
-
-    if (_compare_tag_xx(element_registry[tags_xx_index[imid]].tag_str,
-                        key_str) < 0)
-      imin = imid + 1;
-    else
-      imax = imid;
+  // Try find key from 'tag_t tags_registry[]' using the perfect hash.
+
+  uint32_t seed =
+      tag_hash_seeds[_hash_tag(key, 0) & (SIZE_TAG_HASH_BUCKETS - 1)];
+  int idx = tag_hash_slots[_hash_tag(key, seed) & (SIZE_TAG_HASH_SLOTS - 1)];
+  if (idx >= 0 && tags_registry[idx] == key)
+    return (ElementRegistry *)element_registry + idx;
+
+  // Try find key from repeating group tags, e.g. (60xx,3000).
+  // Masks with more digits are tried first.
+
+  for (int m = SIZE_TAGS_XX_MASKS - 1; m >= 0; m--) {
+    const uint32_t *mask = tags_xx_masks + m * 3;
+    uint32_t value = key & mask[0];
+    int imin = mask[1], imax = mask[2] - 1;
+    while (imin < imax) {
+      int imid = (imin + imax) / 2;
+      if (tags_xx_values[imid * 2] < value)
+        imin = imid + 1;
+      else
+        imax = imid;
+    }
+    if (tags_xx_values[imin * 2] == value)
+      return (ElementRegistry *)element_registry + tags_xx_values[imin * 2 + 1];
   }
 
-  if ((_compare_tag_xx(element_registry[tags_xx_index[imin]].tag_str,
-                       key_str) == 0) &&
-      (imax == imin))
-    return (ElementRegistry *)element_registry + tags_xx_index[imin];
-
   // can't find tag from registry
 
   return nullptr;
@@ -240,22 +233,36 @@ const char *TAG::keyword(tag_t tag) {
   return "(Unknown Data Elements)";
 }
 
+static inline uint32_t _hash_keyword(const char *keyword, size_t size,
+                                     uint32_t seed) {
+  // same as hash_keyword() in 'misc/codegen_builddict.py'
+  uint32_t h = 0x811c9dc5 ^ seed;
+  while (size--) {
+    h ^= uint32_t((uint8_t)*keyword++);
+    h *= 0x1000193;
+  }
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  return h;
+}
+
 // Element's Keyword -> Tag
 tag_t TAG::from_keyword(const char *keyword) {
-  int imin = 0, imax = SIZE_INDEX_KEYWORD - 1;
-  while (imin < imax) {
-    int imid = (imin + imax) / 2;
-    if (strcmp(element_registry[keyword_index[imid]].keyword, keyword) < 0)
-      imin = imid + 1;
-    else
-      imax = imid;
-  }
+  return from_keyword(keyword, strlen(keyword));
+}
 
-  if ((strcmp(element_registry[keyword_index[imin]].keyword, keyword) == 0) &&
-      (imax == imin)) {
-    return tags_registry[keyword_index[imin]];
-  } else
-    return 0xFFFFFFFF;
+tag_t TAG::from_keyword(const char *keyword, size_t size) {
+  uint32_t seed = keyword_hash_seeds[_hash_keyword(keyword, size, 0) &
+                                     (SIZE_KEYWORD_HASH_BUCKETS - 1)];
+  int idx = keyword_hash_slots[_hash_keyword(keyword, size, seed) &
+                               (SIZE_KEYWORD_HASH_SLOTS - 1)];
+  if (idx >= 0) {
+    const char *kw = element_registry[idx].keyword;
+    if (strncmp(kw, keyword, size) == 0 && kw[size] == '\0')
+      return tags_registry[idx];
+  }
+  return 0xFFFFFFFF;
 }
 
 // -----------------------------------------------------------------------------
@@ -367,7 +374,7 @@ vr_t VR::from_uint16le(uint16_t u)
 }
 
 std::string TAG::repr(tag_t tag) {
-  static char buf[16];
+  char buf[16];
   sprintf(buf, "(%04X,%04X)", TAG::group(tag), TAG::element(tag));
   return std::string(buf);
 }
@@ -14636,6 +14636,1494 @@ static const int keyword_index[] = {
 /* Length of longest keyword = 3 bytes,
             shortest keyword = 63 bytes. */
 
+
+const int SIZE_TAG_HASH_BUCKETS = 2048;  // power of 2
+const int SIZE_TAG_HASH_SLOTS = 8192;  // power of 2
+const int SIZE_TAGS_XX_MASKS = 5;
+
+// Perfect hash for tags_registry[]; see _find_tag() in datadict.cc.
+static const uint16_t tag_hash_seeds[] = {
+     3,     7,    10,     5,     1,     1,     0,     4,     2,     3,     4,     2,
+     1,     2,    10,    18,     0,     4,     9,    13,     4,    26,     1,     9,
+    13,     1,     4,     2,     2,     7,     3,     3,     4,     1,     5,     0,
+     3,    13,     3,     1,     0,     1,    10,    26,   134,     8,     1,     4,
+     5,     2,     6,     1,    16,     4,     1,     4,     9,     1,    65,     1,
+   138,     4,     8,     8,     9,     2,     2,     1,     9,     8,     1,     4,
+     8,     0,    14,     1,     0,     1,     4,     1,     1,     9,     0,     4,
+     1,     1,     1,     3,     4,     0,     3,     1,     6,     0,     1,     6,
+     5,     1,     2,     1,     0,     3,     1,     1,     1,     3,     0,     0,
+    15,     1,     1,     8,    10,     0,     5,    38,     1,    25,     4,    10,
+    23,     0,     1,     0,    15,   130,     2,     8,     0,     1,     8,     1,
+     2,    33,     1,     9,     4,     1,     6,     1,     2,     0,    13,     1,
+     3,    14,     0,     0,   132,     2,     1,     2,    11,     1,    49,     8,
+     1,     8,    13,     1,     5,    14,     1,    10,     5,    12,     2,     8,
+     1,     3,     1,     2,     1,     2,     3,     8,     5,     4,     1,    10,
+     1,    25,    50,     2,     3,     6,     6,     0,     4,     3,     3,    12,
+    15,     0,     2,     1,     6,     2,     1,     2,     1,    21,     1,     9,
+     2,     0,    18,     4,     2,     0,     3,    10,     2,     1,    11,     0,
+    32,     8,     8,     1,     8,     1,     2,     1,    10,     4,    13,     1,
+    11,     2,     0,     5,     7,    34,     4,     1,     5,     1,     4,     1,
+     2,     1,     2,     3,     1,     1,   133,     9,     3,     3,     1,     0,
+    86,    11,     2,     4,     2,     1,     3,    19,     5,     1,     1,     2,
+     0,     1,     6,     8,     0,    48,   133,     4,    60,     5,     3,     4,
+     2,     1,    12,     1,    14,     9,     1,     3,     1,     1,     1,     4,
+     5,    22,    10,    10,     2,     3,     8,     9,     7,     6,     4,     1,
+     9,   128,     3,     1,     5,     1,     1,     1,     2,    69,     1,    16,
+     3,    10,     4,     2,    15,     0,     4,     2,     7,     2,     5,     7,
+     5,     2,     2,     1,     0,     7,     2,     3,     4,     2,     1,     1,
+    15,     1,     2,     4,     5,     0,   135,     2,     0,     7,     1,     1,
+     1,     1,     0,     7,     4,     0,     1,     5,    38,   128,     6,     5,
+     5,     9,    21,     1,    12,     1,     6,     2,    63,    60,    11,    20,
+     6,     8,     9,     7,    33,     5,    11,     0,    10,   130,     4,     7,
+     0,     1,     1,     1,     1,     4,     0,     0,     1,     2,     1,     0,
+     2,     0,     5,     0,     3,     1,     0,     1,     1,     7,    11,     1,
+     6,     1,     9,     0,     0,     2,     1,     4,    13,     5,     1,     1,
+     0,    26,     3,    10,    18,    19,     1,     2,     2,     0,    13,     1,
+     4,   147,    35,     3,    39,     2,     1,     0,     9,     9,     1,    12,
+     6,     0,    29,     1,     4,     0,     6,     2,     1,     0,     1,     4,
+     2,    10,     4,     2,     2,     2,     2,     2,     3,     3,    26,     0,
+     1,     4,    14,     1,     4,     7,    64,    10,     5,    10,    17,     8,
+     1,     6,     0,     8,     1,     4,     0,     0,    22,     1,     2,     6,
+     2,    22,     1,     2,     0,     1,     2,     8,     1,    13,    10,    16,
+    16,     1,     8,     1,     1,     1,     1,    13,     3,     1,     4,     3,
+     3,     1,     7,     1,     3,     2,    10,     1,     0,     1,     1,    19,
+     1,     1,     1,     6,    75,     2,     7,     8,     3,     1,     7,     0,
+   130,     2,     1,     3,   135,     6,     9,     0,     4,     0,     5,     4,
+    33,     5,     3,    15,    27,    12,     2,     4,     1,     3,    17,     1,
+     6,    16,    12,     0,    55,    15,     0,     1,     1,     1,    18,     9,
+     0,   145,    21,     5,     8,     0,    64,     1,     1,     7,    21,     0,
+     1,    17,     1,     4,     4,     2,     3,    20,     3,     6,    12,     0,
+     6,     3,     5,     7,     4,     1,     7,     2,    62,    29,     3,     1,
+     1,     1,     8,    15,     2,     2,     2,    14,     1,     1,     1,     1,
+     4,     3,     1,   130,     4,     2,    20,     7,     4,     3,    16,    30,
+     5,    14,   156,     1,     5,     5,    13,     7,     6,     1,     1,     0,
+     6,     2,     9,     5,     8,    23,    14,     0,    12,     0,    46,     3,
+     0,     7,     4,     1,     0,     3,     7,     5,     0,    27,     1,    12,
+     2,     1,     1,    23,     1,     4,    10,     4,     6,    12,     3,     4,
+    12,     1,     2,     8,    12,     0,     2,     8,    83,     2,     2,     4,
+     2,     6,     7,     1,   128,     1,    54,     4,    35,    11,    20,     4,
+     9,     1,    11,    10,     0,     3,     1,    12,     2,     1,    10,     1,
+    12,     4,     3,     1,     5,     1,     1,     2,     4,   132,    17,     0,
+     5,     5,     1,     4,     7,    22,    11,     1,     1,     5,    24,     1,
+     1,     1,     9,     4,     9,     2,     0,    34,     3,     8,     1,     3,
+    13,     3,     1,     1,     0,     9,     2,     1,     0,    24,     3,     1,
+    14,     0,     7,    13,     1,     1,    12,     0,    17,     5,    94,    19,
+    13,     7,     0,     0,     6,     1,     1,     1,     2,    69,     3,     0,
+     2,    76,     0,     2,     4,     3,   128,     1,     1,     3,     8,     3,
+    13,     1,    57,     2,     4,     2,     7,     0,     1,     1,    31,     2,
+     0,     2,     5,    46,     9,    20,     0,     1,     7,    11,     3,    18,
+     2,     1,     6,    11,    16,     0,     4,    25,     2,     0,    39,     1,
+     4,    15,     1,     6,    22,     2,     7,   131,     5,     3,     1,     7,
+    15,    10,     1,     3,     1,   129,    25,    12,     3,     0,     8,     5,
+     1,     1,    13,     3,     1,     6,    37,     9,     0,    36,     0,     7,
+     1,     9,    10,    56,     6,     9,     1,    13,     4,     1,     1,     4,
+     5,     5,     1,     4,     5,     3,     3,    10,     0,     2,     1,     1,
+    29,     1,   130,     2,     0,     3,     2,    30,     1,     9,     4,     5,
+     1,     2,     1,    22,     2,     0,     6,    17,     1,     8,     2,     4,
+     4,     1,     0,    12,    12,     1,     8,     3,     0,    22,     1,     1,
+     8,     1,     1,     7,     2,     5,     3,    40,     1,     2,     2,     2,
+    39,    12,     3,     4,     8,     3,    30,    16,     6,     5,     1,     2,
+     0,     2,   132,     2,     4,   135,     5,    18,     1,   131,     1,   139,
+     0,     1,     2,     6,     3,     5,     2,     7,    30,     3,     4,     1,
+     1,     7,     2,     3,     2,     0,     8,     2,     0,     1,     4,     0,
+     2,     3,     1,     1,    10,     3,     1,     8,     4,     2,     3,     1,
+    21,     5,    23,    35,     4,     5,     2,     3,     7,     8,     4,     0,
+     7,    19,     6,     3,     1,    68,     8,     1,     5,     1,     9,     4,
+     3,     9,    12,    20,     3,     4,    70,     0,    12,     2,     2,     1,
+     8,     6,   128,   135,    21,     1,     2,     1,    12,    41,     5,     1,
+    12,     2,     3,     2,     0,     1,     2,    16,     9,    15,     1,     2,
+    12,    29,     5,    31,     0,     4,     0,    19,     0,     2,     8,    38,
+    13,     7,     2,     8,     3,     3,     6,     6,     8,     9,     9,     1,
+     1,     1,     3,     1,    25,    16,     1,     5,   158,     3,     1,     5,
+     4,     0,    23,     1,     0,     1,     2,     6,     2,     1,     2,   141,
+    25,     6,     9,     0,     1,     3,     8,     0,     5,    36,     2,    18,
+     3,     3,     2,     3,     2,     1,     2,     7,     1,     1,     1,     1,
+     1,    12,     3,     1,     1,    16,     4,     5,     2,    33,     4,     0,
+     1,     3,     8,    26,    65,     4,    27,     4,     7,     1,     2,     2,
+    11,   113,    64,   129,    12,     5,     4,    65,    32,     2,    42,    13,
+    15,     3,     0,    40,     8,     5,     1,    39,    16,     2,     5,    20,
+     0,     8,     8,     2,     3,     3,    15,     8,     1,    15,     0,     1,
+     4,     5,     0,     3,     6,     5,     1,     5,     4,    81,    15,     1,
+     0,    47,   176,     9,    20,     0,     0,     8,     7,    68,    10,    10,
+     2,     9,     8,     2,    32,     3,    37,     3,     3,    14,     1,     5,
+     3,     0,     5,     8,    14,     8,     6,     1,   128,     7,     2,    32,
+    12,     9,     2,    11,    39,    11,     5,     8,    14,     3,     2,     1,
+     2,     1,     1,     3,     1,   132,     6,   128,    29,     1,    11,    18,
+     1,     0,     3,     1,    43,     7,     6,     1,     2,     0,     3,     9,
+     2,     1,     7,     2,    16,   132,     6,     1,     1,     2,     3,     2,
+    16,     1,     1,     8,    13,    21,     3,    66,     1,    18,    29,     2,
+    31,   129,     7,     1,     0,    11,    10,     1,     9,     8,     1,     3,
+    29,     1,     1,    32,     2,    28,    17,    11,     1,     1,     2,     0,
+     8,     6,     2,    11,   128,     0,     0,     4,    69,     6,     5,     3,
+    32,    17,     2,     4,     2,     1,     8,     2,     0,   130,    13,     5,
+     6,     2,     6,     2,     6,     2,     6,     1,     7,    65,     5,     1,
+    42,     1,    17,     6,    14,    26,     3,     6,    13,     4,     1,     1,
+     5,     1,     0,     2,     0,     1,     2,     4,     7,     1,    19,    13,
+   136,     2,     6,     4,    10,    17,     1,     9,     9,     4,     5,     2,
+     3,    29,    17,    44,     6,    43,     2,     0,     2,     2,     7,     4,
+     9,     4,    15,     1,     6,     8,    15,    47,     0,   130,   157,    13,
+   128,     9,     0,     1,     2,     9,     2,   128,     0,     4,    32,     8,
+    85,     4,     1,     8,     1,     0,     1,    21,     1,     9,    26,     6,
+     0,     2,     9,    31,     3,    18,    14,     5,     4,     6,     1,     4,
+     5,     1,    20,     4,     6,    38,    16,     1,    43,     3,     3,    10,
+    12,     2,     7,     7,     3,     0,     2,     1,     6,     3,     2,     1,
+     4,     2,     1,    15,     2,     9,     1,     4,     0,     0,     6,     5,
+     0,    12,     1,     0,     8,     2,     7,     1,     4,     1,    11,     0,
+     2,    17,     9,     5,     8,     0,     7,   131,     1,     1,    13,     0,
+     4,     4,    25,     4,     8,   140,     1,     6,    36,     0,    19,     1,
+     6,     8,     7,     0,     6,     9,     7,     6,     2,     0,     2,     3,
+     3,     4,     0,     1,     1,    17,    10,    34,    21,     3,    24,    10,
+    18,   132,     1,     0,     4,    14,    21,     1,     0,    48,     1,     0,
+     0,    50,    13,     9,     0,   139,     6,     8,     9,    10,   131,    20,
+    26,    20,     3,    11,    16,     3,     1,    11,     5,     9,    31,    16,
+     8,     0,     0,     9,     8,     3,    35,     4,    78,     9,     6,     5,
+     3,     1,     1,     1,     3,     4,    13,    25,     2,     2,    22,     0,
+     2,    12,     0,     0,     8,     0,     2,   144,    39,     7,    23,    15,
+   132,    10,    10,     1,   135,     1,     9,     0,    22,     4,     0,    28,
+     0,    19,     8,     1,     3,    22,     8,    20,     0,     3,    10,     2,
+     1,     9,     1,    15,     3,     5,    15,     4,   139,    10,     4,     8,
+     2,     8,   158,     1,     9,     0,    19,    20,    16,    10,     2,    24,
+     8,     1,     3,     9,     1,    18,     0,     6,     5,    19,    35,    11,
+     0,     1,     9,    80,    25,     1,     1,    50,    10,   130,     6,    61,
+    16,     9,     0,     1,     2,     9,    26,     2,     3,     2,     9,     9,
+     1,     8,     1,     4,     1,    14,    28,    24,     2,    22,     1,     9,
+     0,    24,    32,     9,     2,     9,     9,    10,    10,     3,   132,    23,
+     0,     3,     2,     2,     1,    11,     2,    11,     1,    48,     6,     3,
+     8,    53,     0,     1,     1,     0,    23,     8,     4,     0,     2,    18,
+    74,     0,   138,    16,     0,     9,     1,     7,    16,     2,     1,     1,
+    75,     1,     3,    15,     5,     1,     1,    70,    17,     2,     9,    18,
+    10,     4,    58,     3,    22,     1,     5,     5,    79,    43,     9,    39,
+    24,     1,     4,    11,    27,     0,   161,     1,     2,    13,     9,    75,
+    13,     0,    34,    14,     4,    11,    34,     1,    18,     9,    20,     1,
+    39,     0,    42,    29,     1,     1,     1,     1,    70,     2,    32,    12,
+    22,     4,    10,     8,    14,     8,     2,    13,     4,     2,    20,    51,
+     4,     8,     5,     1,     4,     1,    11,     0,     1,     0,     0,   118,
+     4,    16,     9,     3,     9,     0,    26,     1,     0,     3,    31,     4,
+     3,     0,    26,    17,    28,     0,     5,     1,     5,     3,     0,     0,
+     0,     6,   136,     0,     3,    15,    15,     0,    14,    11,    14,    64,
+    63,     1,    51,    34,     1,    11,    33,   130,    17,     0,     2,    17,
+    14,    19,    50,     1,     5,    30,    10,     0,     3,     1,     3,     4,
+     1,     2,    12,    11,     4,     0,     6,     8,     3,     6,     0,    14,
+    18,     0,     5,     9,    30,     1,     2,     0,     4,     1,     4,     4,
+    32,     0,    54,    46,     0,     1,    22,     1,   129,    66,     2,     3,
+   141,     4,    68,     3,     1,    68,     1,     3,   146,     1,     2,     3,
+    14,     9,     2,    20,    29,    35,     7,     0,     0,     1,     3,   125,
+    14,     2,     1,     1,     4,     0,     3,    38,     1,     9,    28,     6,
+    17,    20,     3,   130,     2,     0,   129,    17,    79,     2,    51,     3,
+    17,     5,    39,     1,    51,    87,     9,    17,     7,     4,    28,     0,
+    60,     0,     1,   131,     4,     1,     2,     2,     5,     2,     2,    53,
+    18,    33,    10,    13,     2,     0,    27,    32,     2,    33,    10,     9,
+     9,     2,     1,     1,     6,    11,    14,    17
+};
+
+static const int16_t tag_hash_slots[] = {
+  238, 2872,  560, 3517,   -1,  378,   -1,   -1, 4084, 2503, 2039,  208, 2683,   -1,   -1,  293,
+ 2344,   -1, 4674,   -1, 2497,   -1,   -1,   -1,   -1,   -1, 4513,   -1,   -1, 1978, 1086, 3618,
+ 3412,  918, 3868,   -1,   -1, 2441,   -1,   -1, 3283,   -1,   -1,  439,   -1,   -1, 1462,   -1,
+ 1183,   -1, 1806, 3629,   -1, 2812,   -1, 4697,   -1,   -1,   -1, 2061,   -1,  545, 1913,   -1,
+   -1, 1453, 3301,  368,  855, 1500, 2692,   -1, 2850,   -1, 1766, 2328, 3592,   -1,  116, 3389,
+ 1176,   -1,   -1,   -1, 3548, 2743, 3872, 1645,   -1,   -1, 3398, 2668, 1107,   75, 3887,   -1,
+   -1,  355,  809,  996,   -1,   -1,   -1,   -1, 2827,   -1,   -1,   -1,  481, 3772,  471, 2799,
+   -1, 1330,   -1,   -1, 3202,   -1, 3646,   -1,   -1,   -1, 1849,   -1, 4518, 4598,   -1,   -1,
+   -1,   -1, 3384,   -1,   -1, 3263,   -1,   -1, 2778, 2635, 3850, 1413, 2308, 4534, 1130,  157,
+ 3484, 3407, 2458,   -1,   -1, 2304,   -1, 1795, 1113, 1722, 1653, 2734,  289,   -1,   -1,  213,
+   -1, 4430,   -1, 1257, 2639, 3814,   -1,  925,   -1, 1352, 2303, 3137, 3969,   -1, 3671,   -1,
+ 1184, 2288,   -1, 2682, 2905, 2223,  579,   -1, 3276,   -1,  137,   -1,   -1,   -1,   -1, 1741,
+ 1650,   -1, 1224,   -1,   -1, 4782, 3463, 2444, 1122, 2755,   -1, 3678, 2264,   -1,   -1,   -1,
+ 1831,  755, 3615,   -1,   -1, 4276, 2897,   -1,   -1, 3268, 2612,   -1,  993,   -1, 4740,   -1,
+ 4017, 1392, 4627,  395, 1642,   -1,   -1,  233,   -1, 4800,   -1, 3783, 3094,   -1,   -1, 2640,
+ 4485, 4079,   -1, 4841,   -1,   -1,   -1, 3684,   25, 2394, 3233,   -1,  153, 1644, 2007,   -1,
+   -1, 3878,   -1,   -1, 2118,   -1, 3650, 2477,   -1, 3490,   -1,   -1,   -1, 4686, 2182, 1559,
+   -1, 3760,   -1,   -1, 3171, 4180, 2091, 1187, 3583,   -1,   -1,   -1,  779, 2505, 4631,   -1,
+   -1,  142, 1198, 1080,  939,   -1, 1948,   -1, 4738, 4708, 1289,   -1, 1291,   -1,   -1, 2032,
+   -1, 3091,   -1,   -1,   -1,  575,  701,   -1,   -1, 3036, 4502,   -1, 4170,   -1,  400, 1100,
+ 2291, 4400,  121, 2293, 2172,   -1,   -1,   -1,   -1, 4655, 2339, 2472,   -1, 3361, 1275,   34,
+ 3117, 4289, 1631, 2731, 4467,   -1, 4680, 4208,   -1,   -1,   -1, 1211, 2703,   -1,   -1,  166,
+ 1973,   -1, 2000,  582, 4712, 4270, 4757,   -1,   -1,  821, 3164, 2256,   -1, 1985, 3300,   -1,
+   -1, 3754, 3288,   -1,  777, 1534, 2353,   -1, 4267, 3016,  863, 2001, 1095, 4602,   -1, 4463,
+ 2888, 3627, 4251,  967, 1444,   -1,   -1,   -1, 2566,   -1, 4448,   -1,  375, 1709, 4131,   -1,
+ 3995, 2019, 1408,   -1,   -1,   -1,  911, 3523, 4488, 3810,  786,   -1, 3429, 3201, 3827,   -1,
+  168,   -1, 3956, 2594,  438,   -1,   -1,  635, 3423,   -1, 4291, 4606, 3492, 4581, 3234, 2460,
+ 4416, 2593, 1348,  710,   -1,  398, 4625,   -1,   -1, 1607,   -1,   -1,   -1, 3011,   -1, 1456,
+ 3099,   -1,   -1, 4666,   33,   -1,   -1,   -1,   -1, 3494,   -1, 4367,   -1,   -1, 3439, 1344,
+ 2134, 1279,   -1,   -1,   -1,   -1, 2848,   -1, 4438,   -1, 3595, 1902, 4005,   96,   -1, 1074,
+   -1, 1775,   54, 2170, 3735, 2295,   -1,   -1, 1446, 2246, 1915, 3083,  992, 1715, 1342,   -1,
+  663,  105, 2877,  135,  954,   -1,   65, 3557, 3658,   -1, 2360, 1404,   -1, 4252, 3625, 4338,
+ 1523, 2486, 4657, 2419,  848,  379,   -1, 1900,   -1,   -1, 4762,   -1, 4174, 2413,  641, 3106,
+ 2407, 1230,   -1, 4168,   -1, 4809,   -1, 1430, 1322, 2542,   -1,   -1, 4339, 1612, 4165,   -1,
+ 1668, 3296, 2967, 1786, 1044,   -1, 1421, 3110,   -1, 1087,   -1, 4314, 4584,   -1, 1684, 4677,
+   -1, 1877,   -1, 3589,   -1, 1759, 3355,   -1,   -1, 3571,   -1,   -1, 1846,    9, 1778,   -1,
+  999, 1935, 1137,   -1, 4729,   -1,   -1, 3782, 3382,   -1,  235,  307, 1557,    5, 3198,   -1,
+   -1, 4107, 4066, 1548, 1343, 2923,   -1, 3665,   -1, 4333, 3044,  728, 1433,   90, 3329,   -1,
+   -1, 1627,   -1, 2402, 1819,   -1,   -1, 4492,   -1, 3884, 2297,   -1,   -1,  749, 1639,   -1,
+   -1, 2047,  784, 4343,   -1, 2073,   -1, 3065, 4439, 1340,   -1,   -1, 2169,   -1, 4117,   -1,
+   -1,   -1,   -1, 1391,  751,   -1,   -1, 4346, 4710,   -1, 4781,   -1, 1911,   -1,   -1, 2446,
+   -1,   -1, 4358, 2426, 1514, 2556, 4835, 1560, 1990, 3512, 2631,   -1, 3906,   -1,  347,  279,
+ 1498,   -1,   -1, 2876, 2864,   -1,  189, 1135, 1912,   -1,   -1, 2790, 3138, 2543,   -1,   -1,
+ 2961, 2806, 3733, 3093,  436, 2240,   -1, 2971,   -1, 3659,  602, 4830,   84,   -1, 1486,   -1,
+   -1,   -1,  712, 4015, 4768,   -1, 1727,   -1, 3379,   -1, 1274, 1417,   -1,   -1,   -1, 1667,
+ 1215, 1329,   -1, 4420,   -1, 1919,  466, 2523,   -1, 4491,  669,   -1,   -1, 2370, 2193, 2028,
+  787, 3278, 2494, 1916,   -1, 4579,  629,  370, 3362, 3470,   -1,   -1,  340, 2557,   -1,  527,
+   -1,   -1, 2322, 4337, 2418,   -1, 3664, 4764,   -1,  760, 1554,   -1,   -1, 3942,   -1,   92,
+ 2265, 3125, 1995,  433,   -1,  106,   -1,   -1, 4167, 3237, 4426,  637, 1681, 2804,   -1,   -1,
+ 1676, 2652, 2697, 3529, 2592, 3509,   -1,   -1,   -1,   -1,   -1,   -1, 1423,   -1, 3621, 1123,
+   -1, 3779, 1712,   -1,  909, 3660, 4139,   -1, 4543,  697, 4684, 4785,   -1,  894,   -1,  317,
+   -1, 4799, 1478, 1649, 4413,   -1,   -1, 3250, 4257,   -1, 3528,   -1, 4315,  195,   -1,   -1,
+ 4068,   -1, 4461, 1467,   -1,   -1, 2933, 1797, 3204, 3834, 2736, 1353, 4824,   -1,   -1, 2478,
+   -1, 1159, 4742, 3445,   -1, 1252, 3196,   -1,   -1, 4371,  651, 4507,   59,   -1, 3403,   -1,
+ 4189, 2086, 3797, 1511, 4703, 3114,   -1,   -1,   -1,  693, 4411, 1454,  325,   -1,  584,  654,
+  300, 1867,  563,  772, 1519, 3448, 4778,   -1,   -1,   -1, 2258, 1756, 3195, 1678, 1451, 3692,
+ 1345,   -1, 2179,   -1,   -1, 1010,   -1, 2875,   -1, 2031,   -1,   -1, 3070,   -1, 4011,  321,
+  886,  638, 2685, 1656,   -1,   -1, 4788,   -1,   -1, 3520, 2126, 4044, 1236,   -1, 4183,   -1,
+   -1,   -1,   -1, 1487,  241, 4179,   -1, 2325, 3889, 2768, 2927,  516, 2664, 2466,  301, 3273,
+ 1750, 2879,   -1, 4815, 1337,   -1,   -1, 4114,   -1, 2895, 1050, 2305,   -1,  210, 1481,   -1,
+   -1, 3775,   -1, 1399, 4619, 1561, 2774, 4560,   -1,   -1,   -1, 4528, 4111,  717,   -1,   -1,
+   -1,   -1, 1748,   -1, 1225,   -1,   -1,   -1,   -1, 1579, 3179,  202, 4052,   -1,   -1, 2279,
+   -1, 2625,   -1,   -1, 1079, 1774, 2349,   -1,   -1, 2259, 2314, 2414, 3888,  632,  832,   -1,
+ 1698, 1360, 2601, 1134, 3844, 1301, 4399,   -1,  687,   -1,  334, 1677,  689,   -1, 1577,   -1,
+   -1,   -1,   -1,   -1,   -1, 4497,   -1, 1926, 1133,   -1,   -1, 2722, 1575,  902, 4392,   -1,
+   -1,  521,  504,   -1, 2124, 4186, 4083,   -1,   -1, 3601, 4352, 3721,   -1,  312, 2710,   -1,
+   -1, 2375, 1745, 3488,   -1, 3817, 1711, 4080,   -1,   -1,   -1, 3657, 3789, 4644,  230,   -1,
+   -1, 2119,  224, 3080, 1991, 4335, 3900, 4320, 2008,  491,   -1, 1331, 3262, 2913, 4104, 3852,
+   -1,  677,   -1,   -1,   -1,   -1,   -1,  862,   -1,  490,   -1, 2653, 2453,   -1, 1966, 3980,
+ 1488,   -1, 1581,   -1, 2239, 4047,   -1, 1823, 2155, 3729, 2887,   -1, 1355,   -1, 3320, 3127,
+ 3711, 2284,   -1,  872, 4035,  417, 1931, 1059, 2359,   -1, 2298, 4238,   -1,   -1,  513,   -1,
+ 1426, 1393,   -1,   -1, 4570, 3392,   -1, 3805,   -1,   -1,   -1,  676, 1808,   -1,   -1, 2959,
+   -1,   -1,   -1, 1616, 1472,   -1,   -1,   -1,   -1, 2672, 2379, 4037,   -1, 4734, 4435,   -1,
+ 3378,   -1,   -1,   -1,   -1,   -1, 1096,  561, 1338, 1336,   -1, 4687, 4790, 3356, 4610, 4709,
+   36,   -1,   56,   -1, 3410, 4031, 4616,   -1,   -1,  350, 3623, 1105, 3777, 2143,   -1, 3427,
+ 2995, 1265,   -1,   -1, 1401,   -1, 3934, 3610,  509,   -1,   -1,   -1,   -1,   -1, 2354, 4391,
+ 3035,   -1,   -1, 1022,   -1,   -1,  206, 1192,   -1, 1553,   -1, 2316,  415,   -1,   -1,  844,
+ 2037,    6, 3933,   -1, 2989,   -1,   -1,  788,   -1, 2534,   -1,   -1, 4283,   -1,   -1,  940,
+  574, 3315,   -1,  388,   -1, 2253, 4679, 4444,   -1,   -1, 3391, 4733,   -1,  783, 1794,   -1,
+  209, 4500, 2459,   -1,  547,  236,   -1, 2374, 4353, 3739,  549, 4097,   -1, 3061, 2605, 3574,
+ 1807,   -1, 3098,   -1, 1052,  799,  493, 4453,   -1, 4597, 3471,   -1,  336, 2979,   -1,   -1,
+   -1, 3981, 4590,  540, 3973, 1036,   -1, 1761, 4274, 2292,   -1,   -1,   -1, 4539,   -1,   -1,
+   -1,  541,   -1, 1876, 3252, 2009,   -1,   -1,  314,   -1,  785, 2589,   -1,   -1,  533,   -1,
+ 1648,   -1, 4541,  187,  262,   -1,   -1, 2435, 4585,   -1,   -1, 2931, 2929,   -1,   -1,   -1,
+ 1255,   -1,   -1,   -1,  743,   14,   -1, 2608,   -1,   -1,  606,   -1, 2928,   -1, 2271, 4792,
+   -1,   -1,   -1,  465,   -1,   -1,   -1,   -1,   -1, 1151, 3841,  747,   -1, 3383,   -1, 3327,
+ 3393,  394, 2871, 1282,   -1, 4230,   -1, 3551,   -1,  356,  171,   86,   -1, 4151,  131, 2828,
+   -1,   -1,  913, 4551, 3015, 2417, 3732, 2669,   -1,  203,   -1,   -1, 2343, 2840,   -1,   -1,
+   -1,  984, 4287,   -1,   -1, 2759, 1909,   -1,   -1,   -1, 4007, 2565, 1411,   -1,   -1, 1463,
+   -1, 2969, 1812,   -1,  595, 4102, 3938, 4019,  708,   -1,   -1,   -1,   53,  269,   -1, 1328,
+ 4403,  419,   -1,   -1, 3374, 2968, 2539,   -1,  389,   -1, 1248,   -1,   -1, 1315,  276,  176,
+ 1873, 2540, 3543,  476,   -1,   -1,   -1, 3979,  391,  148, 2885, 3256, 2535, 3705, 3819,  878,
+   -1, 3996, 2844, 4649, 3856, 2194,   -1, 1006,   -1,   -1,  205,   -1,   -1, 2965,   -1,  748,
+   -1, 3136,   -1,   -1, 1675, 2767, 2538,   -1, 3677, 3147,   -1, 4145, 1788,  473, 2758, 3258,
+   -1, 1944,   -1, 3824, 3555,   -1,   -1,   -1,   -1, 2235, 3388, 1178,   -1,   -1, 1060,   -1,
+ 1194,   -1,   -1, 1738,   -1, 1432,  184,   -1, 2481, 4384,   -1, 2536, 2675,   -1, 4427,   -1,
+   -1,   -1, 1833,   -1,   -1,   -1, 3926,   -1,   -1,  420,   -1,   -1, 2421, 2528,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1, 3911,  820,   -1,   -1,   -1, 3943, 4663,   -1, 2559, 3892,   -1,
+   -1,  538, 3255,   -1, 4812,   -1,   -1,   -1, 1119,   -1, 1167,   -1,  371,   -1,  630,   -1,
+ 1186, 4383,  771,   -1,   -1,   -1,   -1, 3420,   -1, 4206,   -1, 3914, 1851,   -1, 2974, 3550,
+ 2139, 1469, 4210, 4607,  577,   -1, 2311,   -1, 4745,  132, 3513,   -1,   -1, 2808, 4418,   -1,
+   -1,   -1, 1381,  791,   -1,    7,   -1,   -1, 3697,   -1,   -1, 1547,   -1,   -1,   -1, 1598,
+ 2785, 2425,   -1,   -1, 3213, 3762, 3723,   -1,  136,   -1,  866,   -1,   -1,   -1,  695,   -1,
+   -1, 3089,   -1, 1376, 4660, 2209,  744, 2509, 2205, 1066, 1829, 3175, 3457, 3245,   -1, 2984,
+   -1, 2945,   -1,   -1, 1168, 3425,   -1, 2129,   -1,  859,  357,   -1,   -1, 4408, 2059, 1175,
+  648,   -1, 4515,   -1,   -1,   -1,   -1, 2783,   -1,  108,   -1, 2670,   -1, 3916, 4220, 3337,
+   -1,   -1,   -1, 2899, 1617,   -1, 1549, 2281,   -1, 2791,   -1,  155, 2136,  329, 2131,   -1,
+ 4810,   -1,   -1,   -1,   -1,   -1, 3968,   -1, 4454, 2025,   -1,  609,   -1, 3960, 4535, 1994,
+   -1,   -1, 3267, 4006,  974, 4133,   -1, 4038, 4702,   -1, 3670, 3249,   -1, 3867,   -1, 3274,
+   -1, 2475, 1859,  154, 2097, 3308,   -1, 4143,   -1, 3381, 3806,   -1,   -1, 4196,   -1, 1407,
+ 1325, 2798,  117,  172,   -1,   -1,   -1, 2966,   -1, 1904, 3949,   -1, 1346,   -1, 3076,   -1,
+   -1,   -1, 3030, 4701,   -1, 4577, 2619, 2150, 1817,  526,   -1,   -1, 4013,  691,  511, 3314,
+ 4450, 4527, 4115,   -1, 3149,   -1,   -1, 3111, 2952, 3404,   -1, 4021,  622,  887, 3572,   -1,
+   -1, 4059,  254, 3508, 4675, 1739, 1946, 3115, 4635,   -1, 4182, 1385,  907, 4293,   -1,  562,
+   -1, 3829, 1998,   -1, 4060, 1063, 3862, 1099,   -1,   -1,   -1,   -1,  765,  149, 1480,  227,
+   -1,   -1,   -1,   -1,   -1,   -1, 3738, 4504,   -1,   -1,   -1, 4722,   -1,   -1,   -1,   -1,
+ 2994,  272,   -1, 4361,   -1,   -1,   -1,  868,   -1,   -1,   -1, 2522,  474, 4161, 2310, 4795,
+ 2261,   -1, 4611, 1228,  173,  734, 3536, 2846, 2720,   -1,   -1,   -1,   -1, 4285, 2986,  413,
+ 3212, 2092, 4425,   -1,   -1,   -1,   -1,   -1, 2156,    4,  468, 2192, 4629, 3808, 4100,   -1,
+  612,  286, 1662,  807,   -1, 3720, 1205, 1262, 1019,   -1, 2329,   -1, 4247,   -1,   -1, 4802,
+ 2287, 1905, 3464, 2650,   -1,   -1, 1321,  758, 2451,   -1, 3205, 1227,   -1,   -1,   -1,  761,
+ 2572, 4826,   -1,   -1,   27,   -1,   -1,  349, 3932,   -1, 2403, 4770,  941,   -1,  245,   -1,
+ 1067,   -1,  740,   -1, 1736,   -1, 4304, 3075,  486,   -1, 1489,   -1, 4330,   -1, 2957,   -1,
+ 2740, 4198, 1574,   -1,   -1,   -1, 2599,   -1, 1375, 2867,   -1,   50,  578, 3190,   -1,  445,
+   -1,   -1,   -1, 2436,   87,   -1,   52, 1567, 1435, 2598,   -1, 4549, 1240, 1772, 1764,   -1,
+  653,  593, 2519, 1354,   -1,  304, 2365, 1382, 1308, 3501, 2587, 3987,   -1, 2398, 4253,   -1,
+ 4547,   -1,   -1,   -1,   -1,  297, 2404,   -1, 4113,   -1,   -1, 4833,   -1,   -1,   -1, 4707,
+ 2177,   -1, 2366, 3726,  626,   -1, 3057, 2078, 3169, 4525,  600,  814, 1564,  803,   -1,   -1,
+ 4057,   -1,   -1, 3055, 2469,   -1, 3701, 2821,   -1, 3156,   -1, 2551, 2881,   -1,   -1,   -1,
+   -1,   -1, 1217, 2883,   -1,   -1,   -1,   -1,   -1,   -1, 4160, 3192, 3796,   -1,   -1, 1918,
+   -1,  111,   -1,   -1, 2655, 1965,  851,  251,  214, 4517, 3232,   -1, 4503, 2597, 2610, 2988,
+ 3763,   -1,   -1,   -1,   -1,   -1, 3193,   -1, 4713,   -1,  557,  558, 3507, 4327,   -1,   -1,
+   -1, 4683, 2654, 4615,   -1,  699,   -1,  446,   -1, 2140,  667, 4478,   -1,   -1, 3022, 2537,
+ 1943, 3977,   -1, 3971,   -1, 3821, 1476,   -1,   -1,   -1,   -1, 1277,   -1,  517, 4290,  244,
+   -1, 3530,   -1, 1922, 2780, 4069,   -1, 3674, 4661,  604,   -1,   -1, 2884,   -1, 1254, 2745,
+ 3304,   -1, 3895,   -1,   -1, 1949,   -1, 4188, 1588,   -1,   -1, 2651,   -1, 3375, 4163,   -1,
+ 1686,   -1,  294,   -1, 2546,   -1,   -1,   -1,  961, 1605,   -1, 3753, 4098,  879, 3417,   -1,
+   -1,   -1,  919,   -1, 4303,   -1, 1679, 3452, 2005,   -1,   -1,  816,   -1,   -1, 3454, 3672,
+   -1, 1670,   -1,  605, 1951, 3785, 4095, 1054, 2568, 3624, 1725, 3372,   -1,   -1, 3788,   -1,
+   -1, 3539,   -1, 3395, 3828,  702, 1986,   -1, 1699, 4265, 4511,   -1,  929, 1471,   -1, 2429,
+ 3353,   -1,   -1, 2226,   -1,   -1, 4214, 2527, 1302,   -1, 4140, 1615,   -1, 3430,   -1,   -1,
+   -1, 1889, 2137, 1907, 4125, 2488, 2244, 2003,  531,   -1,   -1,   -1, 3346,   -1,   -1, 3741,
+ 3758, 3504,   -1, 4521,   -1,   -1, 3728, 3708,  342,   -1,  381, 1835, 1403,   -1, 3450,   -1,
+ 3617, 4089,   -1, 2513,   -1,   -1, 4563, 2706,   -1,  983, 3756,   -1, 4373, 1619, 2390, 1878,
+   -1, 3848, 3903,   -1,   -1, 2080,   -1,   -1,   -1, 4308,   -1, 2510, 3069, 1452,   -1,   -1,
+   -1, 2468, 2951, 3045,   -1,  997,   -1, 1845, 2724, 2514,   -1, 2937, 3734, 3223,   -1,   -1,
+   -1, 2860, 3712,   -1,   -1,   -1,   -1, 1146,   -1, 4643,   -1, 3433,   -1, 2962,   -1, 2048,
+  412,   -1,   -1,   12,  310, 3792, 1848,   -1,   -1, 4578,   -1, 1954,   -1,   -1, 2262, 4112,
+ 2332, 1397,   -1,  664,  353,   -1, 1026,   -1,   -1,   -1,  506,  127, 3087,   -1,   -1,   -1,
+   -1,   -1, 3696, 4647, 4813,   -1, 4292, 1961,   -1, 1920, 1729, 1377,   -1,   -1,   -1,   -1,
+ 2715,   -1,   -1, 1246,   -1,   -1,   -1, 2083, 3167, 4277,   -1, 1213, 3491,   95,   -1, 3023,
+ 1796, 2423,   -1,  455, 1618,   -1, 1803, 4736,   -1, 2996, 2894,   -1,   -1, 1901,   -1, 1866,
+   -1,   -1, 3768,   -1,   -1, 3886,   26, 3709, 3680, 1593,  354,  873, 2309,  968,   -1,   -1,
+   -1,   -1,  889, 3009, 1441,  831, 2801,   -1,   -1,   -1, 2180,   -1,   -1,   -1,   -1, 1164,
+ 4078, 1929, 4651,   -1, 3880,   -1, 3857, 4215,   -1,   -1,   -1, 3401,   -1,  675,   -1, 1474,
+ 1356, 3231, 1551,  339,   -1, 2399,   -1,   -1,   -1, 4149, 1847,   -1,   -1,   -1,  808, 1108,
+   -1,   -1, 3266,   -1,   -1, 1960,  101,   -1, 4807,  295, 4483,   -1,   -1,   -1,   89, 4002,
+ 2624,   -1,  636, 4421, 2939,   -1, 2341,   -1,   -1, 4789, 3983,   -1,   -1, 3812, 3791, 1047,
+ 2313,   -1,   -1, 4771, 3073,   -1,   -1, 2662, 3350,   -1, 3722, 4212,   -1,   -1, 3860, 1386,
+   -1,   -1, 3873, 1606, 3519,   -1,   -1,   -1,   -1, 3993,   -1, 2746, 3961, 4594, 3469,   -1,
+   -1, 2882, 3473,  361, 2728, 4199, 2613, 3224, 1034, 1455, 3816, 4219, 1326, 4834, 3243,   -1,
+   -1, 2553,   -1,   -1, 2677,   -1, 1040,  292,   -1, 1825,   -1, 2529, 2831,   -1,   -1, 4236,
+   -1,   -1,   -1, 1571, 2628,   -1,   -1, 2010, 1636, 1700,  479, 3527, 3793,   -1, 3311, 4432,
+ 3974,   -1,  642, 2795,  404, 3704, 3461,  220, 3449, 4331,   -1, 3157, 3631,   -1,   -1,   -1,
+   -1,   -1, 3929,   -1, 2034,   -1, 3013, 1785, 4794,  120,   -1,   -1, 3580,   -1,   -1,   -1,
+  598, 4250,   -1, 3181, 4510, 3054, 4106,   -1, 4817,  773,   -1, 4825,   -1, 4536,   -1, 2408,
+ 2285,   -1,   -1, 1000,   -1, 1898, 3566, 1501,  278, 3113, 1643,  977,   -1,   -1,  138,   -1,
+   -1, 1154, 2658,   -1,   -1,   -1, 3874, 3499, 3066,   -1,   -1, 1094,   -1,  125,   -1,   -1,
+ 2372,   -1,   -1,   -1, 3594, 2392, 3699,   -1, 2561,   -1,   -1, 2547, 2450,  434,   -1, 2063,
+ 3652, 2548, 2099,   -1, 4207,   -1, 2020,   -1,   -1,   -1, 2570,  134,   -1,   -1, 3170,   -1,
+ 3611,   -1,   -1,  631,   -1,   -1,   -1, 4763, 3086, 3319,   -1,  789, 2012,   -1, 4694,   -1,
+   -1,   -1, 3142, 1881,   -1,  264,   -1, 3541,  299,   -1, 3927,  601, 4393,   -1,   -1,  191,
+ 2763,  752, 3144,   -1,   -1, 4016,   -1, 1110, 4382,   -1, 3326,  129, 2249,   -1, 2796, 1927,
+   -1,   -1, 3776, 3948,   -1, 1219, 2496, 1046,   -1, 4313,   -1, 1735, 2454,   -1,   -1, 3608,
+   -1, 2257,   48,   -1, 1327,   -1, 3780,   -1,   -1, 1466, 1368, 4260,   -1, 3215,   -1,   -1,
+   -1,   -1, 4612,  437, 4431,   -1,   -1,   -1,   -1,  494, 1160, 2744,   -1, 3209, 1037,   -1,
+ 4474, 1111,  428,  567,  884,   -1,  846,   -1, 4755, 1768,   67, 1528, 3458,  882,   85,   -1,
+   -1, 1673, 4842,  945, 1477, 2236,   -1, 4752, 3322, 1491, 4583,   -1,  798,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1, 2181,   -1, 4472,   -1,   -1, 4523,   -1,  741, 1842, 4259,   -1,
+ 3002,   -1,   -1, 1069, 2707,   -1, 3731,   -1,   -1,   -1, 4070, 1177, 4747, 3336,   -1, 3609,
+   -1, 4537,   -1, 4575,   -1,   -1,  112, 2166, 4012,   -1,   -1,   82,   -1, 2898, 4417,   -1,
+   -1,   -1, 3216, 2095, 2858,   -1,   -1, 1724, 2286,   -1,   -1,   -1, 4137,   -1, 4360, 4571,
+ 3774, 2766, 2432,  726, 1771, 4398, 4746, 4484,   -1,  219,   -1,   -1, 2044, 3347, 1799, 3963,
+ 3436, 3865,   -1,  369, 1997,   -1,   -1,   -1,  141,   -1,  423, 4397,   -1, 4221, 2391,   -1,
+   -1,  263,   71,   -1,  113, 4226,   -1, 2254,  729,   -1,   -1, 2738, 2412, 2508,   -1, 3123,
+   -1, 2438,   -1,   -1,   -1,  671, 1450,   -1,   -1, 2250, 1917,   -1,  298,   -1,   -1, 1767,
+ 3254, 2294, 4126,  850, 1680,  981, 2077, 3104, 1078, 1042,   -1, 2515,  520,   -1, 2352, 2985,
+   -1, 1697, 1938, 1076, 3807,   -1,   -1,   -1,  802,  467, 4428, 3864, 1089,   -1,   -1,   -1,
+   -1, 2558, 3698, 2474,   -1, 4312,   -1,   -1, 2447, 4486, 1271,  597, 3846, 1757,   -1, 3493,
+ 3119, 3506, 2700,   -1,   -1,  950, 1114,  616, 2204, 2779, 4354, 1116, 2789,  181,   -1, 4239,
+   -1,   -1,   -1, 4837,   -1,   -1, 2521,   -1,  722, 1414, 1971,   -1, 3584,   -1,  425,   -1,
+ 4505,   -1, 1310,   -1,   -1,   -1,   -1, 4123, 4294,  589, 1239, 2068,   -1,   -1,  382, 4190,
+   -1, 1479,   -1, 1084, 3116,  892,   -1, 1936,   -1, 4264, 2805,  781,   -1, 3928, 4217,   -1,
+   -1, 3641, 1039,  226,  794,   -1,   -1, 4532, 3591,   -1, 3203, 4218,  315, 4501,   -1,  782,
+ 1140, 1963,   -1,   -1, 1828, 1424, 1299, 1409,   -1,   -1,   -1, 4321,   -1, 2163, 2133,   -1,
+  432, 3642,   45, 3854,   -1, 2886, 1810, 3060,   -1,   -1, 3442, 1752, 4775,   -1, 1070, 3418,
+   -1, 1743, 1243, 4829,   -1,   -1,   -1,   -1, 3217, 4258, 1962,   -1,   -1, 4749,   -1, 2832,
+  614, 2647,   -1,   -1, 3434,  769, 2600, 4640, 1589,   73,  284, 3622,   -1,   -1,   -1, 4751,
+   -1, 1587, 4099,   -1, 3021, 3997, 1138, 1264, 2835, 4108, 1813, 1542, 1863,   49, 1332, 3364,
+  451,   -1,   -1,   -1, 1623,   -1,  680,   -1,   -1,   -1, 2487,   -1,   -1,   42, 1007,   -1,
+ 1541,   -1,   -1,  140,   -1,  928,   -1, 1388,   -1,   -1,  122, 4832,   -1,   -1, 4761, 1350,
+ 1510,  688, 2197, 2906, 2410,   -1, 1179, 4626,  927,   -1, 1864,   -1,   -1, 2948,  401,   97,
+  192, 4766, 3092,   -1,   -1, 1191,  259, 2709,   -1, 4449,   -1,   -1, 4692,  239, 2595,   -1,
+   -1,   -1,   -1,   -1, 4434, 2174,   -1, 4067, 4200,   -1, 4048,   -1,  536, 3921,  422,   -1,
+ 1004,   -1,   -1, 2278,   -1,   -1,  905, 3058,   -1,   -1,   -1,   -1,   -1,   -1,   -1, 3241,
+   -1,   77,   -1, 4473,   -1,   -1,   -1,   -1,   -1,   -1, 4796,  243, 1509, 4249,   -1,   -1,
+ 2815, 1753,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1, 2364, 2052,   -1,   -1,   -1,
+ 3062, 4325, 2833, 3166,   -1,  475, 1533,  502, 3885,  700, 4668, 1163,   -1, 4442,   40, 4227,
+   -1,   -1, 2614,   -1, 2376,   -1, 2973,   -1,  268,   -1,   -1,   -1,   -1,   -1,   -1, 4362,
+ 3316,   -1, 2930, 2498, 2645,   -1, 1718,   -1, 3972,   -1,   -1, 3682, 4608,   -1, 2676,   -1,
+   -1, 1204, 2604,  207, 1341,   -1,   -1,   -1, 2319, 2582, 3000, 2907, 4022, 3832,  737,   -1,
+  288, 4618,  650,  817,   -1,   -1, 1158,   32,   -1,   -1,   -1,   -1, 1011,   -1,   -1, 2109,
+ 1267, 4803,   -1,   -1, 4685,  194,   -1,   -1,   -1,  871, 2090, 1837,   -1, 3321,   -1, 3737,
+   -1, 3140, 3669, 3489, 3905, 2241, 2208, 4440,   -1, 4401,   -1, 2334, 1242, 4540, 3210, 3825,
+   -1, 2101,   -1, 3265,   -1, 3477,   -1,  932, 2579, 1083, 3003, 1494, 3649, 3947,   -1, 2116,
+  813, 2921,   -1, 1200,   63, 1260,  483, 4081,   -1,   -1,   -1,   -1,   -1,  964,   -1,   -1,
+   -1,   -1,   -1, 2213,   -1, 4197,  881, 1540, 2234,   -1, 4205,  372, 4232, 2819,   -1, 3120,
+ 1475,   -1,   -1,   -1,   -1,   -1,  800, 1537, 3230,   -1,   -1,  553, 1791, 4599,  823, 3005,
+  505, 1790, 2055,   -1, 2723,   -1,   -1,   -1,  757,   -1,   -1,   -1,   -1,   -1,   -1,  893,
+ 2787, 1324, 2904,   -1,   -1,   -1, 1585, 2211,   -1,   -1, 1583,   -1, 2947, 4407,  380, 1440,
+ 4550, 1490, 3688, 3358, 3838, 4357, 1535,   -1,  484,   -1,  908, 3909, 2185, 1895, 2159, 2924,
+   -1, 1552, 1573, 4284, 4202,   -1,   -1, 4569,   -1, 4010, 1082, 3992, 1088, 4242, 4589, 4316,
+ 1906, 4419,   -1,   -1,  732, 4718,   -1,   -1, 4144, 3428,  764,   -1, 4187, 1952, 2127, 4582,
+ 1696, 1844,   -1, 1827, 4103,   -1,   -1, 2964, 1104, 2747,   -1,  956, 3260,   -1,  161, 4750,
+ 2229,   -1,   -1,   -1,   -1, 3500,   -1,  570, 4664,   -1,   -1, 1253,   -1,  790,   -1,  756,
+ 3010, 3596, 2269,   -1, 3474, 4042, 3043, 4328,  666, 4588,   -1,   -1, 1891,   88,   -1, 4801,
+   -1,   -1,   -1,   -1,   -1, 3281,  797,   -1,   -1, 4191,  965,   -1, 2915, 3689,   -1,   -1,
+   44, 2880, 2085,   -1,   -1, 3667,   -1, 1529, 2183,   -1,   -1, 2120,    1,   -1,   -1,  656,
+ 2718,  951, 1273, 1362,   -1, 3100,   -1, 3719, 2324, 2260, 2018,   -1, 2717, 3743, 1843,  611,
+   -1,   -1, 4676,   -1,   -1,   -1,  421,  766,   -1, 1660,   -1,  565,   -1, 1005,   -1,   -1,
+ 4514, 4557,   -1,   -1,   -1, 3479,   -1,   -1,   -1, 4756,   -1, 2462,  810, 2296,   -1, 2270,
+ 4051,   -1,   -1,   -1,  723,   -1, 1707,  290,   -1,   -1,   -1, 4405,   -1,  319,   -1,   -1,
+   -1,   -1,  852, 2128, 3570,   -1,   -1,   -1, 2748, 4158, 1664,   -1,  910, 4716, 1914,   -1,
+   -1,   -1,   -1,   -1,   -1,  778,   -1, 4028,   -1,   -1,  903,   -1,   -1,   -1, 3159,   -1,
+  665, 3823,   -1,   -1, 2219, 2501,  683, 1251,   -1,   -1, 4076,   21, 4340,   -1,   -1,   -1,
+ 3620, 4704,   -1,   -1, 1762,   -1,   -1, 3901, 4693,  715,   -1,  270,   -1,  150, 1157,   -1,
+ 4414,  572, 3435,  973,   -1, 1822, 3399, 2082,   -1, 3251,   -1, 1976, 2607, 4596, 3097, 3208,
+ 4004,   -1, 2490, 1156, 3459, 2089,   -1,   -1, 3599, 4381, 2400, 4231, 1503,  544,   -1, 2465,
+ 2492,   -1,   -1, 1405, 3991, 3008, 2070, 3107, 3331, 3818, 1091,   -1, 2862,   -1, 2397,  309,
+   -1,   -1,   61,   -1,   -1, 3912,   -1, 3773,   -1, 1614,   -1, 2689, 4780, 1714,   -1,   -1,
+   -1, 4811,  114, 2326,   -1, 1620,   -1, 1072, 4529, 2442, 3502, 1207,   -1,   -1,  248, 1195,
+ 1815,   -1, 1173, 3029,   -1, 3602, 4119,   -1, 2642,   -1,   -1,   -1,   18,   -1,   -1, 1972,
+ 4489,   -1, 2903,   -1, 4041,   -1,  623, 2711,   -1,  581, 4233,   -1,   -1,   -1, 4609,   -1,
+ 4466,   91, 3432,   -1,  123, 3604,   -1,  915, 2963, 4714, 2449, 1820, 2615,  265, 2932,  842,
+   -1,   -1, 3890, 4073, 4725,   -1, 3771, 3578,  857,   -1, 4365, 4204, 1981, 1530,   -1, 2443,
+ 1283,   -1,   -1,   -1,   -1,   -1, 1065, 4678, 1460, 4014,   -1, 1201,   -1,  452,  613,   -1,
+   -1, 1704, 3902,   -1, 3673, 1683, 1674, 1448, 2157,   -1,   -1,   -1,   -1,   -1, 1688, 4302,
+   -1, 3376, 3787, 2189, 4744, 1153, 1591, 2526,   -1, 3877, 3128,   -1,   -1, 1379,   -1,  901,
+   -1, 4224, 1874,   -1, 2011,   -1,  599,   -1,   -1,   -1,   -1,   -1, 3742, 4094,   -1,  240,
+   -1,   -1,   -1,  875, 4645, 4769,   -1, 1389,   -1, 3441,   -1, 3014, 2852, 4088,   -1, 4092,
+  143,   -1, 2911, 2912, 4299,   -1,   -1,  615,   -1, 1449,   -1,  718, 2814, 3248,   -1,   -1,
+   -1, 1245, 3426,   -1,   -1, 3141, 1968,   -1,   -1, 2699, 2714,   -1,   -1, 4255,   -1, 1286,
+  829,   -1,  146, 2918,   -1, 3101, 4043,   -1, 3139,   -1, 1208,  995, 3284,   -1, 2646, 3962,
+ 3480, 3207, 3496,   -1, 3447, 2377,   -1, 3802, 4240, 1370, 3424, 2726, 1237,   -1,   -1, 3521,
+   -1,   -1,   -1, 4553, 4071,   -1,   -1,   -1, 4526,   -1,  931,   -1,   -1, 1250, 1582,   -1,
+ 1893,   -1,   51,   -1,   -1,    2,  366,   -1,   -1,   -1, 3690,   -1,   35, 1223, 1814, 1720,
+ 2797,   -1, 1657, 4372, 1603,  934,   -1, 1544, 2922, 2280, 1611,   -1,   -1,  559, 1380, 4166,
+ 2993,   -1, 1387, 1197,   -1,   -1, 2873,   -1,   -1, 1263, 1563,   -1, 1303, 4670, 3750,   -1,
+   -1, 2656,   -1,  338,  759,   -1, 1125, 2485,   -1, 1737,   -1,   -1, 2992, 3526,   -1, 4136,
+ 4838, 4806, 3227, 4690, 2463,   99,   -1,   -1,   -1, 3048,   -1, 4554, 3736, 1436,  962, 3614,
+  500,   83,   -1, 4617,   -1,   -1, 4658,  285,  660,   -1,   -1,   -1,   -1, 2276,   -1, 3630,
+ 3764,  256,   -1,   -1, 3299,  211,   -1,   -1,   -1,   -1,   -1, 4366, 1294,   -1,   -1,  985,
+ 3455, 2802,   -1,   -1,   -1,   -1,   -1, 1188, 4753,  690,   -1, 3634, 1887, 1958, 3573, 4457,
+   -1, 3628, 2550, 1821,   -1,   -1,   -1,   -1, 4566,   -1, 3685, 4776, 3915,   -1,  163,   30,
+ 3408,   -1, 4153,   -1,  957,   -1, 4263, 2926,   -1, 1284,   -1, 1658,   -1,  959, 4388,   -1,
+   -1,   -1,   -1, 2826,   -1,   -1, 1974,   -1, 2228, 1989, 2532, 3158, 1062,  564,   -1,   -1,
+   -1,  461,   -1,   -1, 2574,   -1, 2690, 4542,  175,   -1,  655, 3552, 1152, 1855,   -1, 4665,
+ 2186,   -1, 3405, 1415, 2188,   -1,  548, 2560,   -1,   -1,   -1, 4634, 4732,   -1,   -1, 2214,
+ 3317,   -1, 3600,   -1, 2530, 2151,  898, 2217, 1621, 2739, 3162, 1285,   -1, 2471,   -1,   -1,
+ 4469, 1638,   -1, 4096, 2839,   -1,  731,   -1, 1880, 2502, 1339,   -1,   -1,   -1, 4132,   -1,
+ 4805, 1316,   -1, 3681, 1057,   -1,  804,  313, 2878, 1634, 3406, 4464,   -1,   -1,   -1,   -1,
+   -1,  644,   -1,   -1,   -1, 2358,   -1, 3781, 4317,  618, 2046, 2602,  359,   -1,   -1,   -1,
+ 2634, 4689, 1464, 1713, 4671,   -1, 4364, 3964,  883, 2909,   -1, 1127, 3124,   -1, 2900,   -1,
+ 4342,   -1, 1624,   -1,   -1,   -1,   -1,   -1,   -1,  156,   -1, 3001,   -1,  620, 2708,   81,
+  362,   -1,   -1,   -1,   69, 4468, 3534, 3533, 2215,  923, 4524, 2942, 1502, 4309,   -1,   -1,
+   -1,   -1, 3421,  662, 2470,   -1, 4545,   -1,   -1, 1628,  164, 4530,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   41,   -1,  885,   -1,   -1,   -1, 1090, 2810, 2473,   -1,   -1, 1546, 2122,
+ 2890, 1008, 3908, 3468, 2190,  217,   -1,   -1, 1800, 3475,   -1, 2943, 3145,  670,   -1, 2132,
+   -1, 1143, 4424,   -1,  946,   -1, 2388,   -1,   -1, 3804, 4374,  916,   -1, 4319, 4558,   -1,
+ 2517,   -1,  444, 3079, 2057,   -1,   -1, 4572, 4691,   10,   -1,   -1, 3397, 3822, 2811,   -1,
+   -1,   -1,   -1,  990, 1029, 3199,   -1, 3444,  119,   -1,   -1,   -1,   -1, 3744,  232, 3510,
+  625, 3335, 3068, 2200,   -1,  969,   -1, 1967, 1371,   -1, 3027, 4455, 2300,   -1, 2830,   -1,
+   -1,  720,   -1, 2567,   -1, 2576, 1485, 1400,   -1,   -1, 2105,   -1,  280,   -1,   43, 1928,
+ 4743,   -1, 2114,   -1,   -1, 4451,  861,  978,   -1, 3177, 3514,   -1, 2445,   -1,   -1, 4396,
+   -1,   -1, 2721, 2688,  363,   -1,   -1, 4062,   -1, 2772, 1431,  537,   -1, 1439, 3253, 4023,
+   -1,   -1,  190,   -1,   -1,   -1,  489,   -1,   -1, 3907, 1630, 1868,   -1,   -1,   -1, 1226,
+ 3633,  935,   -1,   -1, 1765, 4105,   -1,   -1, 3668,   -1, 3607,   -1, 1351, 1038, 3298,   -1,
+ 2773,   -1, 1723, 1570,   -1, 1305,  345, 4157,   -1, 3112,   -1,  566, 2569, 1665, 3959, 3340,
+ 4128,   -1, 3103,  115, 2058,  735,   -1, 1170,   -1, 3863,   -1, 2648, 2870, 4368, 3994,   -1,
+ 4008, 2972,   -1, 1640,   -1,  865,   -1,   -1,  159,   -1, 2976,   -1,   -1,   -1, 1209,   -1,
+ 4297, 4181, 4638, 3151, 2489,   -1, 3830,   -1,   -1,   -1,   -1,  107,   -1,  374, 3586, 3656,
+ 1512,   -1, 4286,   39,   -1,   -1,   -1,   -1,  552,   -1, 1706,  933, 1830,   -1, 2679, 4409,
+  576,   -1,  497,   -1, 3024, 3343, 1276, 1558, 2577, 1942, 3686, 4711,   -1,   -1, 2511, 2716,
+  296,   -1,   -1, 3025,  249, 2452, 3135,   -1,   -1,   -1, 2289,   -1, 3271, 4436,  657, 1999,
+ 3999,   -1,   -1, 2627,  303, 2807,   -1,   -1,  826, 3635, 2141, 2573, 3881, 3761, 2206, 3077,
+ 3465,   -1, 3778,  373, 4034, 1805, 4567,   -1, 3755, 3847,   -1, 1755,   -1,   46,  592,  104,
+   -1, 3556, 2014,  860,   -1,   -1, 3751,   -1,   -1,   55,   -1,   -1,   -1, 4295, 3221, 4705,
+ 3338,  246,   -1, 1987,   -1, 4349,   -1, 3605,   -1, 3341,   64,  492,   -1,  188,  351,   -1,
+   -1,   -1, 3133,   -1, 1733,   -1, 3954,   -1, 1520,   -1,   -1,   -1,   -1,   -1, 1798, 3766,
+ 2274,  441, 3431, 3088,   -1,   -1,   -1,   -1, 3769, 2056, 3831, 2088,   -1, 3626,   -1,  838,
+  426, 2004,   -1,   -1,   -1,   -1, 1930,   -1, 2145, 2113,  530,   -1,   -1,   -1,   -1, 3740,
+   -1,   -1, 3535,   -1, 2516,   -1, 3842,   98, 2245, 3936, 4604,   -1, 1580, 2770, 2428,   -1,
+ 3851,   -1,   -1,   -1, 4395, 2564,   -1,   -1, 4423, 4637, 2997, 4827, 1053,   29, 2983,   -1,
+ 2125, 3146,   -1,  698,   -1,   -1,   -1,   -1, 4150,   -1, 2938,   -1,   -1,   -1, 3725, 4244,
+   -1,   -1,   -1,   -1,  989, 1231,   -1,   -1,   -1, 2916, 4593,  393,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1, 2461, 1882, 1058, 4574, 1349,   -1,  555,   -1, 3049,  739,   -1, 4496, 4639,
+ 2176,   -1, 3790,   -1, 3096,   -1, 4533, 2836,   -1, 2482, 3324,   -1,  410,   -1,   -1,  955,
+   -1,  418, 2201,   -1, 2067,   -1,   -1, 4184,   -1, 1933,  174, 1258, 2027, 3293, 3246, 1792,
+ 2649, 4307,   -1,  424,   -1,   -1,   -1, 2222,   -1,   -1, 2998,   -1, 3945, 2195,   76,   -1,
+ 3998,   -1, 3305,   -1, 3478, 1760,   -1,   -1,   -1,   -1, 4216, 1784, 2816,   -1,   -1,   -1,
+  453,  824, 2701, 4087, 1395,   -1, 3006,   -1,   -1,   -1,  833,   -1, 1009, 4243, 2606, 2144,
+ 3451, 1199,   -1, 3180,  780,  324,   -1, 2457,  196, 3121,  102, 2636, 2079, 1988, 3046, 4029,
+   -1, 1317, 1556,   -1, 3165,   -1, 4587,   74, 3839, 2165,   -1, 2820, 1212, 3438,   -1,   -1,
+  811,  926,   -1, 2042, 1682, 3568,   -1, 2100, 3020, 1071, 3590,   -1, 4715, 2147,   -1, 2345,
+   60, 3918, 1932, 3495,   -1,   -1,   -1,   -1, 2666,  151, 3538,  408, 1425, 2756,  795,   -1,
+   -1, 3277, 3540,   -1,  971, 2754,   -1,   -1, 4828,   -1, 1221, 4699,   -1, 3074, 2267,   -1,
+   -1, 1836, 4311,   -1, 4278, 4101, 2533, 2006, 3019, 1024, 3516, 4093, 2618,   -1,   -1,   -1,
+   -1, 3639,   -1, 3219,   -1,  960,   -1, 1266, 3174, 3007, 2902, 1081, 3239, 3440,   72,   -1,
+ 2866,   -1,  532, 2713, 3843, 2583, 1576,   -1, 4429, 3047,   -1, 1499, 4351,   -1, 2693,   -1,
+ 3718, 2017,  580,   -1,  870, 1496,   -1,   -1, 4211,  306, 2555,  454,   -1, 2829,   -1,   -1,
+   -1,   -1, 2732,   -1,   -1, 1594,   -1,  525, 2491, 2416, 3178, 4652, 1730,   -1,   -1,   -1,
+ 1369, 1953, 3939, 1861,   -1, 1311, 4375,   -1, 3185, 3875, 2464, 4748, 3655, 1964,  472, 1203,
+ 3286,   -1, 1983, 1003,   -1,   -1, 1608, 2337,   -1,  738, 2075, 4499,  261, 1061,   -1,   -1,
+ 2987,   -1,   -1, 1816, 3446,   -1,   -1, 1313, 2107,  725, 2033,  673, 4476, 1017,   -1,   -1,
+   -1,   -1,   -1,   -1, 3366,  352, 3333,   -1, 1148,   -1, 2500, 1578,   -1,   -1,   -1, 2164,
+   -1,   -1, 2901,   -1, 4804, 1632,  260,  478,   -1, 3503,   -1,  291,   -1,   -1, 1890, 1115,
+  450, 2687,   -1,   11, 1234,  596,   -1,   -1, 3390,  327,   -1,   -1, 2071, 3549, 3613,   -1,
+   -1,  958, 3575,   -1,  274, 4406, 2175, 2367, 2356,  169, 2586,   -1,   -1,   -1, 2917,   -1,
+ 3619, 1984, 1776, 3416,   -1, 2525,  594, 1980, 1309, 1335,   -1,   -1, 3651, 1838,   -1, 4355,
+ 1043,   -1, 3130,  287, 4622,   -1, 3836,   -1,   -1,   -1,   -1,  713, 1068,   -1, 1568, 2657,
+ 4090, 4030, 1307,   -1,   -1, 3691,   -1, 2575,   -1,   -1,   -1, 3368, 1001,   -1,   -1,   -1,
+   -1,  308,  218,  386, 3236, 2338,   -1, 1691,   -1, 3031,   -1,   -1,   -1, 4390,  837, 1584,
+   -1, 3941, 4344,   -1,   -1, 1484,   -1, 1818,   -1, 3919,   -1, 3714,   -1,  888,  100,   -1,
+ 1527, 4508,   -1, 2855, 3702,   -1,  854, 2064,   -1,   -1,   -1, 1875,   -1, 1804, 1505,   -1,
+ 1367, 1694,   -1, 1145, 1256, 2103, 1787, 3152,   -1,   -1,   -1,  126, 2342, 1092, 1461, 3866,
+ 1041,   -1, 3765, 2015, 2719,   -1,   -1,   -1,   -1, 2158, 2856, 3414,   -1, 1703, 4203,   -1,
+ 2838,   -1, 1865,   -1, 3554, 4636,  776, 2273, 2944, 1856,   -1,   -1,   -1,   -1, 3695, 4075,
+  952, 3476, 4586,   -1,   -1,   -1,  942, 3485, 2420, 3172, 1596,   -1, 2637, 4481, 1106, 1515,
+ 4298,  167, 4306,   -1,   -1, 3344, 2603, 3126,  685, 3063,   -1, 1655,   -1, 3357,   -1,   -1,
+   -1, 1910,   -1,   -1,   -1, 2096,   -1,   -1, 4682, 3042, 3487, 3026,   -1, 2667, 2362,  406,
+ 4498,   -1,   -1,   -1, 2023,   -1,   -1,   23,   -1, 4378, 2611,  603, 4300, 1318,   -1,  856,
+   -1, 2381, 3661,   -1, 4003,   -1,   -1,  399,   -1,   -1,   -1, 4632, 2162, 1124, 3345,   -1,
+   -1, 1592,   -1,  335, 1701,   -1,   -1,  830, 4648, 4369,   -1,   -1, 1685, 4777, 2307,   -1,
+   -1, 1992,   -1, 3285, 4719, 1304, 2506, 4839,  275, 2045, 1419,   -1, 2571, 4621,   -1,   -1,
+ 3419,  200, 1229, 2340, 2424, 1625, 3275,  237, 3467,   -1,   -1,   -1, 4720, 4056,   -1, 1347,
+   -1, 2752, 2178,   -1,   -1,   -1,   -1, 1416,   -1,   -1, 2098,   -1, 4301, 3662, 3422,   -1,
+ 2318, 2896,   -1, 1513, 2660, 2834, 1390,   -1,   -1, 3257, 3240, 4261, 1161, 4329, 2480,   -1,
+   -1,   -1, 2977,   -1, 1507, 2761,   -1,   -1,   -1,   -1,   -1, 4020, 4739, 3724,   -1, 2040,
+ 1550,  796, 3359,   -1,   -1,  672, 3978, 3815, 4445, 4446,  805, 4152,   -1, 1438, 3727,   -1,
+   -1, 4185, 4793, 4148, 3211, 4146,   -1,   -1,   -1, 1858,   -1,  617,   -1, 3085,  643,   -1,
+ 4159,   -1,  165, 4465,  633, 3706, 3809,   -1, 3310,   -1,   -1, 1259,   -1,   -1,   -1, 3483,
+ 4386, 2609, 3078, 2076,   -1, 2385, 1538, 3585,   -1,   -1, 2315, 2065, 1518,   -1, 3894,   -1,
+   -1, 2735,   -1,   -1,  178, 3870, 4458, 2380,   -1,   -1, 2357,   -1,   -1, 4269,   -1,   -1,
+  377, 3853, 1190,  763, 3653, 2863, 1117, 3845, 4779, 2351, 3348,   -1, 1118,  774, 1857,   -1,
+ 2742,   -1, 1545,  845,   -1, 1809,   -1,  836,   -1,   -1, 3587, 1166, 1566, 4760, 2383,  681,
+ 3387, 1126,  948,  523,   -1, 2549, 2154,  899,   -1,   -1,   -1, 1357,   -1,   -1, 1402,  920,
+   -1, 4818, 1641,   -1,   -1,   -1, 4009, 1705,   -1, 2022, 3920, 4783, 1940,   -1, 4477,  694,
+ 4213, 2437, 1174,   -1, 4254, 2788,   -1, 3328, 1781,   -1, 2251, 1064, 2518, 1565, 1085,   -1,
+   -1,   -1, 4282,   -1, 4836,   -1, 1298, 3957,   -1, 2643,   -1,   -1,   -1, 4142,  801,   -1,
+   -1,   -1, 1165,   70,   -1, 3295,   -1,   -1,   -1, 2727, 4195,   -1,   15, 3833,   -1, 1363,
+ 1773, 4175, 3225, 3982, 1754,   -1, 4275,   -1, 2950,   -1,   -1, 1131,  429, 3683,   -1,   -1,
+ 3325, 3303, 3051,  242, 3786,   -1,   -1,  998,   -1, 1470, 4121,   -1,  416, 2069, 4192, 4018,
+   -1, 3747,   -1,   -1, 3986,  733, 4063,   -1,  645, 1220, 2306,  944,  634,   -1, 3931, 1671,
+ 3004,   -1,   -1,   -1,  815,   -1,   -1, 2686, 2135,   -1, 3386,   -1,  591, 2908, 2775,   -1,
+   -1,  703,   -1,   -1, 2386, 1045, 3882, 2659, 1777,   -1, 3544,   -1,   -1, 2016, 3309, 4786,
+ 3675, 2117,   -1,   -1, 1428, 1180,   22, 3876, 4646, 3168, 2563,   -1,   -1,   -1, 1840,   -1,
+   -1, 2617, 4820, 4134,   -1, 2978, 1112, 2330, 3644,   -1, 3588,   -1, 1366, 3694, 4730, 2733,
+ 1493, 2626,   -1,   -1, 3134,   -1, 2837, 4129, 1296, 3339, 3056, 1189,   -1,   -1,  546,  110,
+ 2751, 3923, 2782, 3967, 4305, 1996,   38,   -1, 3542,  145,  573, 3228,  463, 4178,   -1,   -1,
+   -1, 4296,   -1, 3752, 2108,  229, 2925,  462, 2405, 2857,  364, 1747,   -1, 4045,   -1, 3082,
+   -1, 2946,   -1, 4641,   -1, 1789, 1659,  640, 4001,  659,   -1, 1280,   -1, 1524, 4036,   -1,
+   -1, 3270,   -1, 2142,   -1, 3700,  534, 3409,  430, 2590,  231,   -1, 1268, 3687,   -1,   -1,
+ 2765,   -1,   -1, 4110, 2545,   -1, 4667, 2230,   -1,   -1,   -1,   -1, 2869,   -1,   -1,  464,
+ 2198, 4387, 2842,  323,   -1,   -1,   -1, 3710,   -1, 3182, 4334,  457, 3899,   -1,  160, 3559,
+   -1,   -1,  819,   -1,   -1,  876, 2663,   -1, 2941, 3917, 3244, 4332,  305,   -1,   -1, 3373,
+   -1,   -1, 2327,   -1,  806, 1292, 3415,   -1,   -1,   -1,  921, 4823, 3396, 3143,   -1,   -1,
+  947, 2146, 3332, 1569, 1031,   -1,   -1, 3803, 4380,  711,  320,   -1, 3050, 1600, 1073,   -1,
+ 2936,   -1,   -1, 1610,   -1,   -1,   -1,   -1, 2320,   -1,   -1, 2940,   -1,   -1,   -1,  503,
+ 4348, 3235, 4559, 4054,   -1,  215,   -1,  223, 3306, 2224,   -1, 1202,   -1,   -1,   -1, 3561,
+   -1, 2448,  793, 2914, 1023, 2809,   -1, 1506,   -1,   -1,   -1, 4512,  994,  405, 2312, 2671,
+   -1,   -1, 1172,   -1, 4194,  825,   -1,  621, 3515,   -1, 2949, 2363, 2212, 1129, 4600, 3287,
+   -1, 2013, 1721,   -1, 2036, 3975,  495, 4225,   -1,  341,   17,   -1,   -1,  273,   -1,   -1,
+   -1,   -1, 4437,   -1, 2493, 2920,   -1,   -1, 2220, 1839,   -1, 1862, 1586,   -1, 1690,   -1,
+ 3598,   -1,   -1,   -1, 1249, 1637,   -1, 3965,   -1,  365,  900,   -1, 2430, 3290,  118, 2062,
+   -1,   -1, 1035, 3966, 2184, 2678,   -1,  587,   -1, 3313, 3707, 2479,   -1,  330,   -1, 3558,
+  949, 2859,   -1,  201, 1742, 4490,   -1,   -1, 1147, 4245, 1120,   -1,   -1,  529,   -1,   -1,
+ 1783, 2841, 4767,   -1,   -1,  133, 3837,  716, 3402, 3411, 4727,   -1, 4482,   -1, 2348,  982,
+   -1, 2562,   -1, 4033,   -1,   -1,  686,  519, 1222, 2106,   -1,   -1, 4516, 2705, 4568, 4603,
+   -1, 1497,   -1, 4422,   -1,   -1,   -1, 1710, 3052, 3318,   -1,   68,   -1,   -1, 1093,  449,
+ 3041,   -1,   37, 4460,  498,   -1, 1319, 2440,   -1,   -1,   -1, 3498, 1562,   -1,   -1,   -1,
+ 4698,   -1, 2072,   -1,   -1,   -1, 3033,   -1, 2702, 3443,   -1, 3645,   -1, 1051,   -1,   -1,
+ 4772, 4459,   -1, 2935, 1016, 3976,  480,   -1,   -1,  247,  183,   -1, 2024, 1782, 3518,   -1,
+   -1, 2749,   -1,   -1, 3460, 4222,   -1,   -1,  397,  512, 4091, 2066, 2596,   -1,   -1,   -1,
+ 1763,   -1,  316, 1457,   -1, 2784, 1312, 3018,   -1, 2729, 3612, 3562, 2865, 4246, 3108, 1975,
+  221, 1241, 1030,   -1,   -1,   -1, 1749,   -1,   -1, 2630,   -1, 1780, 2954,  311, 3985, 2673,
+   -1,   -1, 1801,   -1,   -1, 2786,   -1,   -1,   -1,  482,   -1,   -1,   -1,   -1, 3064, 1136,
+   -1, 3351, 2822,  212, 1290,  487,   -1, 2233,  991, 3312,   -1,   -1,   -1,   -1, 1097,   -1,
+   -1,   -1, 2955,   -1,   -1, 1957,   -1,   -1,   -1,   -1,   -1, 2960, 1492, 2623,  147,   -1,
+   -1,  834, 2347,   -1, 3532, 3869,   -1, 4653,   -1,   -1,  458, 3294, 2495, 4116, 1599, 3242,
+ 3913, 1398,   -1,  234,   -1, 2112,   -1, 2696, 1443, 2029, 4544,   -1,   -1,   -1, 4735,   -1,
+ 1982, 4279,   -1, 4723, 4613, 3349,  411, 1141, 1959,  193, 2956, 4548,   -1,   -1, 4370,   -1,
+  628,   -1, 1939,   -1,   -1,   -1,   -1, 4576, 1028,  963,   -1,   -1,   -1,  966, 2644, 3930,
+  403,   -1,   -1,   -1, 4814,   -1,   -1, 3784,   -1, 2415,   -1,  328,   -1, 4085,   -1,   -1,
+   62,   -1, 3131,   -1, 3497, 4193,   -1, 1744, 1956, 2153,   -1, 1427,  684,   -1,  277,   -1,
+ 2813, 1075,   -1, 3759,   -1, 4728,   -1,   -1,   -1, 2512, 2218, 3184, 1522, 1532,   -1,   -1,
+ 1601, 1888,   -1, 2581, 4808, 3569,   -1, 3160, 1027,  986,   -1,   -1, 1661,  661,   -1, 3291,
+ 3342,   -1,   -1,   -1,   -1,   -1, 2216, 3323, 2741,   -1,   -1, 1306,   -1, 4228,  709, 1885,
+   -1,  858,   -1, 1969,  253,   -1,   13, 2361, 2853, 1033,   -1,  496,   -1,  877, 3040, 4443,
+   -1,  510, 1572,   -1,  448, 2202,   -1,   -1, 3272,  835, 4288, 4573,   -1,  392,  302,   -1,
+   -1,   -1, 2591,   -1,   -1, 2620, 3028,  258, 4039,   -1,   -1, 4326,   -1,   -1, 1672, 3122,
+ 4462,   -1,   -1,   -1, 2825,  103, 4562,   -1,   -1, 4737, 4628,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1, 3072, 1879,  442,   -1,   -1, 3545, 1921, 1746, 1056,  841, 1945,   -1,   -1, 3553,
+  818,   -1, 4624, 4235, 3647,   -1,   -1,   -1, 3757,   -1, 3990,  535, 3638,   -1,  936,   -1,
+   -1,  896,   -1,   -1, 4831,   -1,   -1, 1383,   -1, 3799,   -1,   -1, 2422,   -1,   -1, 2299,
+ 3893, 2851,   -1, 2762,   -1,   -1,   -1,   -1,  109, 2552, 3813,  367,   -1,   -1,  987, 4171,
+ 3713,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1, 1412, 2053, 2093, 4138,   -1, 4700,  912,
+ 2861, 1300,   -1,   -1,   -1, 4659, 2520,   -1, 1320, 4341,   -1, 4546,  727,   -1,   -1, 3247,
+  639, 3352, 1142,   -1, 4561, 4475,  508,    8,   -1, 2168, 2411,   -1,   -1, 2776,   -1,   -1,
+   -1,   -1, 1609, 4046,  652,   -1, 1422,   -1,   -1,   -1, 1884, 3269, 2263, 1364,   -1, 4000,
+ 2302, 1396, 4201,   -1,   -1, 2026, 2331,   -1,   79,  721,   -1, 3703, 1287, 1238, 4681,   -1,
+ 4141, 4271, 4605, 1841,   -1,   -1,  569, 1555, 2854,   -1,  649,   -1, 2704,   -1, 1728,   -1,
+  679,   -1, 4784,   -1,  762, 3950, 2499,   -1, 4127,   -1, 1021,  822,   -1,   -1,   -1, 2395,
+   -1, 1666,   -1, 4058, 4758,   -1, 1869, 4662,   -1,   -1,   -1,   -1,   -1,   -1, 3034, 1270,
+ 3307,   -1, 4147,  828, 4791, 1669,   -1, 3879, 2999, 3883, 3360,   -1,   -1,  477, 4273,   -1,
+ 1896,   -1, 4531,   -1,   -1, 3946, 2737,   -1, 4774, 3039, 1853,   -1, 3505,   -1,   -1, 3363,
+   -1,   -1,   -1,   -1,   -1, 1716, 2275, 3279,    3,   -1, 2382, 3666, 2227, 2191, 4650, 1663,
+   -1, 4124, 1826, 3154,  880,   -1, 1333, 4086, 4456,   -1,  130, 3897, 3715, 1334, 1850, 1365,
+   -1, 4379, 1955,  976, 4350,   -1,   -1, 4122,   -1,   -1,   -1, 2847, 2680,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1, 3197,   -1,  283,   -1,   -1,   -1,   94,   -1, 1372, 2301,   -1, 2081,
+   -1,   -1,   -1,   -1,   -1, 1602,   -1, 2247, 2389, 2130, 4266, 1740, 3371, 3970, 1779, 3955,
+ 2849,  724, 3200,   -1,   -1, 2369, 1508,   -1,  543,  627,   -1, 4109, 1595,   -1,   -1,   -1,
+   -1,   -1,  515,  257, 1899,   -1, 1613,   -1,   -1, 1635,   -1,   -1,   -1,  186, 4623, 2661,
+  182,   -1,   -1,   -1,   -1,   -1,  528,   -1,   -1,   -1,   -1,   -1,  204,   -1,   -1, 4209,
+ 3394,  282, 3161, 4816, 1171,  897, 4237,   -1,  322,  586,   -1,   -1,   -1,   -1,  179, 3849,
+ 3693, 3597, 1128, 4480,   -1, 2427,   -1,   -1, 4614,   -1,   -1, 2187,   -1, 2953,   -1,   -1,
+  867,   -1, 4819, 4441,  847,   -1,   -1,  696,   -1, 1012, 3525,   -1, 4620,   -1, 3053, 2161,
+ 1049,   -1,   -1,   -1,   -1,   -1, 1013,   -1,  281,   -1,   -1, 4726,   -1, 2694,  972, 2123,
+ 3261,   -1,   -1, 2524,  767, 1102,   -1,  706, 2665, 2990,   -1,  590, 4452,   -1, 3984, 2507,
+   -1, 4580,   -1,  922,   -1,  827, 3188,   -1,   -1,   -1, 4447, 4120, 2371, 4376, 4061, 2588,
+   -1, 4840, 3466,  396,   -1,   -1, 4654,   -1, 2760,   -1,  216, 4234, 3511,   -1, 1169,  407,
+ 2980, 1482, 2406, 1384,   -1, 2638,   -1, 4821, 4050, 1442,   -1, 1646, 3826,   -1,   -1, 3835,
+ 1244, 2823, 1429, 3226, 2674,   -1,  571, 1894,   -1, 1852,   -1, 4256,  128,  499, 4272, 4565,
+ 1314,   -1, 2317,   -1, 2049,   -1, 2094, 1181,   -1,  624,   -1, 2616,   -1, 4040, 3259, 3524,
+   -1, 4843, 4074,   -1,   -1,   -1, 3717, 2378,  943,   -1,   -1,   -1,   -1, 4759,   -1,   -1,
+   -1, 2483, 1032,  198, 1977,  930,   -1,   -1, 3855,   -1, 3749, 4555, 1139,   -1,   -1,   -1,
+   -1, 1539, 1358,  906,  745,   -1,   -1,  348,  704, 1726,   -1,   -1, 4024, 2051,   -1, 3017,
+   -1, 1970, 4717, 4721, 2252, 4268, 2456,   -1,   -1,   -1,  514, 2629, 1834, 1473,   -1,   -1,
+   -1,   -1, 3958,  753,   -1, 4402,  124,   -1,   -1,   -1, 3820,   -1,   -1, 4556,   -1,   -1,
+ 4064,   -1, 3183,   -1,  158,   -1,   -1, 2544, 2203,   -1, 1420,   -1,  337, 4642, 2087,   -1,
+ 3222, 3616, 4520, 1437,   -1, 3581, 1297, 4176,   -1,   -1, 2002, 4065,   -1,   -1,   -1,   -1,
+   -1,   -1,  539,   -1, 2476,  144, 3637, 3037,   -1,  646,  331,  180, 2794,  556, 1892, 2115,
+   -1, 2868,   -1, 4229,   -1,   -1, 2578, 3059, 3937,   -1, 3163,  344,   -1,   -1,   -1,   -1,
+ 3564,   -1,  588,   -1,   -1, 4026,  488, 1832, 4519, 3922, 4433, 4156, 4506, 4172, 1693, 4822,
+   -1,   -1,  585, 2433,   -1, 3095, 1758,  904,   -1, 1232, 1055,   -1, 4385, 1622, 2504,   -1,
+   -1,  346,  768,  607, 3220, 1458,   -1, 4410, 2152, 1717,   -1,   -1, 4169,   -1,  853,  152,
+   -1, 3090,   -1,  199,   -1,   -1,   -1, 3896, 2803,  754,   -1, 1281,   -1, 3282,   -1,   -1,
+ 3935, 4262,   -1,   -1,   -1,  435, 2173, 2409,  970, 2641,   -1,   -1,   -1, 4345, 3563, 1018,
+   -1,   -1, 3648, 3603,   -1, 4538,   -1, 3118, 1629,   -1,  953, 4591, 1373, 1692,   -1, 1521,
+   -1, 4479,   -1, 1216,   -1, 4130,  470,   -1,   -1,   -1,   -1,   16, 2084,   -1,   -1,  376,
+   -1, 3129, 4248, 1269,   -1, 2243, 3365, 1708, 2991, 4595, 2060,   -1, 4415,   -1,   -1,   -1,
+ 4601,   -1,   -1,  197, 3798, 3988, 2632,   -1, 3385,  443, 3148,  770,   -1, 1465, 2335,   -1,
+   -1,   -1, 4032,   66,   -1, 2282, 1860,   -1, 3153,  707,   -1, 4633,   -1, 3229,   -1, 1103,
+ 3032, 3910, 4223,   -1,  705,  719, 4731,  714,   -1, 3071,   -1, 2531, 1689, 1214,   -1, 2691,
+   -1,   -1, 2167, 3730, 4494, 2970, 4798, 4592, 4471,   -1,   -1,  431,  447,  358,   -1, 3859,
+ 1793,   -1,  619, 2171, 2824,   -1,   -1,  895, 3632,   -1, 4324,   -1,   -1, 3453, 4412,   -1,
+ 1144,   -1, 3840,   -1, 2712, 4509,   -1, 3370,   -1, 3676, 1020, 2355,   -1,   -1,  864, 3437,
+   -1,  162,   -1,   -1,   -1,   -1, 2681,   -1, 2910, 4025, 4177,  385, 1459,  610, 3593,  326,
+   -1,   -1, 1098,   -1,  518, 1149, 2268, 2585,   -1,   -1, 1732, 3537,   -1,  427, 2149,   -1,
+   -1, 2455, 1516, 3858,   47,   -1,   80,   -1, 1418,   -1,  678, 1871, 3150, 4552,   -1,   -1,
+   -1, 4493,   -1, 1121,   -1, 2919,   -1,   -1, 1651,   -1, 3486,   -1,  440,   -1, 1447, 2769,
+ 1410, 2242, 1769,   -1,   -1,   -1,   -1, 2277,   -1,  384,   -1,   -1,   -1, 1590, 4656,  937,
+ 4389, 1483, 2695,  988,   -1,   -1,  849,   -1,   -1, 3369, 4470,   -1,  843,  460, 3264, 1101,
+ 3191,   -1, 3081,   -1,   -1,   -1,   -1,   -1,   -1,  775,   -1, 2958,   -1, 3582,  682, 4394,
+   -1, 4564, 4280, 3462,   -1,   -1,   -1, 3794,   -1,   -1,   -1,   -1, 2138,   -1, 4323,   -1,
+ 2396,   -1,   -1, 1947,   -1, 3716,  839, 4072, 1235, 3565,   -1,   -1, 1811, 1155,   -1, 2232,
+ 3472,  980,   -1, 1247,   -1,   -1, 2041,  225,   -1, 1897, 1626,   -1, 1445,   -1,   -1, 4495,
+ 3482,  469, 4164, 3280, 1261,   -1,  874, 2266, 1374,   -1, 1950, 2350, 2800, 3643,   -1, 3189,
+ 3640,   -1, 1361, 1293, 3380,  170, 4754, 3546,   -1,   -1,   -1, 3132, 4673, 3400, 4135, 1597,
+ 3898,   -1,   -1,   -1,   -1,   -1, 2891, 1854,  522, 2196, 2781, 2874,   -1,   -1,  383,   -1,
+ 4724, 1218, 3606,   -1,   -1,  979, 2584,   -1,  318, 1526,   -1,   -1,  485,   -1,   -1,  390,
+  271,   -1,   -1, 1272, 4154,   -1, 2580,   -1,   -1,   -1, 1077, 2248, 3206, 4347,  914,   -1,
+  891, 1048,   -1, 1132,  222, 4155, 1014, 1652,   -1, 3745, 2934,   -1, 2622,   -1, 1883, 1731,
+ 3084, 3679,   -1,  938,   -1, 3186,  542, 3155,   -1, 4336,   -1,  459,   -1,   -1, 4356, 2336,
+ 4773, 1824,   -1,   -1,   -1,   -1,   -1,   -1,  252,   -1, 2148,   -1,   -1,   -1,  917,   -1,
+ 1734, 1002,  177, 1647,   -1,   -1, 2541, 3289,   -1, 1210,  975,   -1, 2393, 2074,   -1, 2771,
+   -1,   -1, 2225, 4669,   -1, 2387, 2283,   -1,   -1,   -1,   -1,   -1,   -1, 2818,   -1, 2346,
+   -1,   -1,   -1,   -1, 4322, 1288,   -1, 4706,   -1,   -1,   -1,   -1, 1434,   -1, 1406, 3292,
+  402,   -1, 2753, 1525,   -1,   -1, 3940,  501,   -1, 2764, 2431, 1886, 3187,   58,  414, 2238,
+ 4359,   -1,   -1,   -1,   -1,   -1,  869,   -1,   -1,   -1,   -1, 1802, 1185,   -1,   -1,   -1,
+   -1, 2845, 3800, 1695,   57, 2030,   -1,  554, 1150,   -1, 2793,   -1, 4118,   -1, 2050,  568,
+ 2368,  360,   -1, 3238,  343,   -1, 3413, 1536,  730, 3214, 3218, 3924, 3871, 3367, 1162, 1702,
+   -1, 2750,   -1,   -1, 3663,  890, 2021,   -1, 2121,   -1,  139,   -1,   -1, 1517,   -1, 3770,
+   -1,   -1,   -1,   -1,  550, 1934, 4241, 1015,   -1, 1468,   -1, 4281,   -1,   -1,   -1, 3105,
+  674, 2434, 1323,    0, 4173, 4672, 1504, 4797, 3579, 3746, 2321,   -1,  792,   -1, 2255, 4055,
+  255, 1394, 2777, 2373, 4162, 3531, 4363, 2892,   -1, 3944,   -1,   -1,   -1, 3334,   -1, 2221,
+   -1, 2621,   -1,   -1,   -1, 2792,   -1,   -1, 1196, 2633, 2199, 2730, 2817,   -1, 3861,   -1,
+ 2110, 1193,   -1, 4695, 2554, 3989,  750, 4765,  608,   -1, 3173, 3176,   -1,   -1,   -1, 2975,
+ 1770,  387,   -1, 2231,   -1, 3560,  524,  812,   -1,   -1,   -1, 4630, 3748, 2484, 3012,   -1,
+ 3102,   -1,   -1, 1687,   -1, 1903,   -1,  250, 1109, 1633,   -1,   -1, 1295, 2757,   -1, 3567,
+ 3481,  736,   -1, 2237,   -1,  332,   -1, 2290, 4082, 1908, 2982, 3377, 4696,   -1, 3576,   -1,
+   -1,   -1,  507,   -1, 3456, 1654,  583, 2893,   -1, 4787, 3953,   -1,   -1, 4741,   28, 2272,
+ 3795, 3801,   -1,   -1, 3925,  924, 1719, 4318,   -1,   -1, 2160, 1870,   -1,   -1, 3951, 2439,
+   -1,   -1,  668,   -1,   -1, 4404,  742,   -1,   -1,   -1, 2323,   -1,   -1,   -1,  746,   -1,
+ 1378,   19,   -1, 3302, 3654,  647, 3522, 3297, 1979, 3109,   -1,  456,   -1,  551, 1923,   -1,
+   -1, 2104, 3354,   -1,   24, 3194,   -1,   -1, 1543,   -1, 2384,   -1, 3577,   -1, 3811,   -1,
+   -1, 1359,   -1, 4077,  840, 2698, 2043, 4377, 2333, 1925, 4688, 2210,   -1,   -1,   -1,   -1,
+ 1751,  228,   20, 4522,   -1,   78,   -1,   -1,  409,   -1,   -1, 2725,   -1,   -1,   -1, 2981,
+   -1,   -1, 2843,   -1, 2038,   -1,  692,   -1,   -1,   -1,   -1, 1993,  185,   -1,   93,   -1,
+ 1937,   -1, 3038, 4053, 4310,   -1, 4027, 1206,   -1,   -1,   -1,   -1, 1278, 2684,   -1,   -1,
+   31, 1924,   -1, 1025,   -1,   -1,   -1, 1872,   -1, 2207, 3330,   -1, 3767,  658, 3952, 3636,
+ 2054,   -1,   -1,  266,  267, 1604, 4049, 2467, 2111,   -1, 2102, 1941, 1531,   -1,   -1,   -1,
+   -1,   -1, 1233, 4487, 3547, 3904, 3067,   -1,   -1, 3891, 2401, 1182,  333, 2035, 2889, 1495
+};
+
+// Repeating group tags; 'x' digits are masked out.
+static const uint32_t tags_xx_masks[] = {  // mask, start, end
+ 0xff00ffff,  0, 71,
+ 0xffff0000, 71, 72,
+ 0xffff000f, 72, 78,
+ 0xffffff00, 78, 79,
+ 0xffffff0f, 79, 88
+};
+
+static const uint32_t tags_xx_values[] = {  // tag & mask, index
+ /* (50xx,0005) */ 0x50000005, 4749,
+ /* (50xx,0010) */ 0x50000010, 4750,
+ /* (50xx,0020) */ 0x50000020, 4751,
+ /* (50xx,0022) */ 0x50000022, 4752,
+ /* (50xx,0030) */ 0x50000030, 4753,
+ /* (50xx,0040) */ 0x50000040, 4754,
+ /* (50xx,0103) */ 0x50000103, 4755,
+ /* (50xx,0104) */ 0x50000104, 4756,
+ /* (50xx,0105) */ 0x50000105, 4757,
+ /* (50xx,0106) */ 0x50000106, 4758,
+ /* (50xx,0110) */ 0x50000110, 4759,
+ /* (50xx,0112) */ 0x50000112, 4760,
+ /* (50xx,0114) */ 0x50000114, 4761,
+ /* (50xx,1001) */ 0x50001001, 4762,
+ /* (50xx,2000) */ 0x50002000, 4763,
+ /* (50xx,2002) */ 0x50002002, 4764,
+ /* (50xx,2004) */ 0x50002004, 4765,
+ /* (50xx,2006) */ 0x50002006, 4766,
+ /* (50xx,2008) */ 0x50002008, 4767,
+ /* (50xx,200A) */ 0x5000200a, 4768,
+ /* (50xx,200C) */ 0x5000200c, 4769,
+ /* (50xx,200E) */ 0x5000200e, 4770,
+ /* (50xx,2500) */ 0x50002500, 4771,
+ /* (50xx,2600) */ 0x50002600, 4772,
+ /* (50xx,2610) */ 0x50002610, 4773,
+ /* (50xx,3000) */ 0x50003000, 4774,
+ /* (60xx,0010) */ 0x60000010, 4786,
+ /* (60xx,0011) */ 0x60000011, 4787,
+ /* (60xx,0012) */ 0x60000012, 4788,
+ /* (60xx,0015) */ 0x60000015, 4789,
+ /* (60xx,0022) */ 0x60000022, 4790,
+ /* (60xx,0040) */ 0x60000040, 4791,
+ /* (60xx,0045) */ 0x60000045, 4792,
+ /* (60xx,0050) */ 0x60000050, 4793,
+ /* (60xx,0051) */ 0x60000051, 4794,
+ /* (60xx,0052) */ 0x60000052, 4795,
+ /* (60xx,0060) */ 0x60000060, 4796,
+ /* (60xx,0061) */ 0x60000061, 4797,
+ /* (60xx,0062) */ 0x60000062, 4798,
+ /* (60xx,0063) */ 0x60000063, 4799,
+ /* (60xx,0066) */ 0x60000066, 4800,
+ /* (60xx,0068) */ 0x60000068, 4801,
+ /* (60xx,0069) */ 0x60000069, 4802,
+ /* (60xx,0100) */ 0x60000100, 4803,
+ /* (60xx,0102) */ 0x60000102, 4804,
+ /* (60xx,0110) */ 0x60000110, 4805,
+ /* (60xx,0200) */ 0x60000200, 4806,
+ /* (60xx,0800) */ 0x60000800, 4807,
+ /* (60xx,0802) */ 0x60000802, 4808,
+ /* (60xx,0803) */ 0x60000803, 4809,
+ /* (60xx,0804) */ 0x60000804, 4810,
+ /* (60xx,1001) */ 0x60001001, 4811,
+ /* (60xx,1100) */ 0x60001100, 4812,
+ /* (60xx,1101) */ 0x60001101, 4813,
+ /* (60xx,1102) */ 0x60001102, 4814,
+ /* (60xx,1103) */ 0x60001103, 4815,
+ /* (60xx,1200) */ 0x60001200, 4816,
+ /* (60xx,1201) */ 0x60001201, 4817,
+ /* (60xx,1202) */ 0x60001202, 4818,
+ /* (60xx,1203) */ 0x60001203, 4819,
+ /* (60xx,1301) */ 0x60001301, 4820,
+ /* (60xx,1302) */ 0x60001302, 4821,
+ /* (60xx,1303) */ 0x60001303, 4822,
+ /* (60xx,1500) */ 0x60001500, 4823,
+ /* (60xx,3000) */ 0x60003000, 4824,
+ /* (60xx,4000) */ 0x60004000, 4825,
+ /* (7Fxx,0010) */ 0x7f000010, 4834,
+ /* (7Fxx,0011) */ 0x7f000011, 4835,
+ /* (7Fxx,0020) */ 0x7f000020, 4836,
+ /* (7Fxx,0030) */ 0x7f000030, 4837,
+ /* (7Fxx,0040) */ 0x7f000040, 4838,
+ /* (1010,xxxx) */ 0x10100000, 3548,
+ /* (1000,xxx0) */ 0x10000000, 3542,
+ /* (1000,xxx1) */ 0x10000001, 3543,
+ /* (1000,xxx2) */ 0x10000002, 3544,
+ /* (1000,xxx3) */ 0x10000003, 3545,
+ /* (1000,xxx4) */ 0x10000004, 3546,
+ /* (1000,xxx5) */ 0x10000005, 3547,
+ /* (0020,31xx) */ 0x00203100, 1558,
+ /* (0028,04x0) */ 0x00280400, 1974,
+ /* (0028,04x1) */ 0x00280401, 1975,
+ /* (0028,04x2) */ 0x00280402, 1976,
+ /* (0028,04x3) */ 0x00280403, 1977,
+ /* (0028,08x0) */ 0x00280800, 1987,
+ /* (0028,08x2) */ 0x00280802, 1988,
+ /* (0028,08x3) */ 0x00280803, 1989,
+ /* (0028,08x4) */ 0x00280804, 1990,
+ /* (0028,08x8) */ 0x00280808, 1991
+};
+
+const int SIZE_KEYWORD_HASH_BUCKETS = 2048;  // power of 2
+const int SIZE_KEYWORD_HASH_SLOTS = 8192;  // power of 2
+
+// Perfect hash for keywords -> index of element_registry[];
+// see TAG::from_keyword() in datadict.cc.
+static const uint16_t keyword_hash_seeds[] = {
+     1,     1,     5,     2,     6,     3,     3,     1,     2,     7,     2,     1,
+     2,     1,     1,     1,     3,     1,     2,     2,     1,     1,     3,     8,
+     1,     1,     2,     1,     1,     4,     1,     1,     3,     1,     1,     3,
+     1,     2,     1,     1,     1,     1,     1,     3,     1,     3,     1,     1,
+     1,     3,     1,     1,     6,     2,     3,     3,     1,     8,     0,     0,
+     9,     4,     2,     1,     1,     0,     1,     2,     6,     1,     0,     1,
+     1,     1,     1,     6,     2,     6,    13,     3,     2,     1,     1,     1,
+     3,     0,     1,     1,     1,     1,     1,     3,     7,     1,    11,     8,
+     1,     5,     2,     7,     1,     2,     1,     1,     1,     2,     1,     2,
+     0,     1,     8,     3,     3,     3,     2,     2,     3,     0,     2,     2,
+     2,     2,     1,     1,     1,     1,     2,     4,     4,     1,     1,     1,
+     3,     1,     1,     0,     3,     0,     2,     4,     1,     2,     1,     0,
+     5,     2,     1,     5,     1,     5,     1,     3,     3,     2,     2,     1,
+     1,     1,     4,     1,     3,     5,     1,     2,     9,     2,     3,     2,
+     1,     1,     5,     1,     1,     2,     3,     1,     2,     1,     0,     0,
+     2,     1,     1,     1,     7,     1,     1,     1,     1,     1,     1,     1,
+     0,     1,     2,     1,     2,     1,     1,     3,     7,     1,     0,     6,
+     1,     3,     3,     2,     1,     1,     2,     0,     0,     9,     2,     4,
+     3,     2,     1,     1,     2,     1,     1,     2,     2,     1,     2,     1,
+     2,     2,     2,     1,     2,     2,     3,     2,     2,     2,     6,     1,
+     2,     4,     2,     8,     3,     1,     2,     5,     1,     2,     0,     1,
+     1,     0,     1,     0,     1,     5,     1,     4,     2,     2,     0,     1,
+     0,     4,     4,     3,     2,     1,     2,     3,     0,     1,     0,     3,
+     2,     1,     1,     1,     1,     5,     5,     1,     5,     1,     2,     1,
+     2,     3,     2,     1,     0,     3,     3,     2,     1,     1,     4,     2,
+     1,     2,     4,     2,     4,     0,     1,     1,     4,     1,     1,     7,
+     1,     3,     1,     0,     1,     1,     1,     1,     1,     0,     5,     5,
+     1,     1,     0,     2,     4,     3,     1,     2,     1,     2,     2,     1,
+     2,     1,     4,     2,     1,     7,     2,     2,     2,     1,     1,     5,
+     0,     1,     0,     1,     3,     1,     0,     0,     3,     3,     4,     2,
+     1,     3,     2,     0,     3,     1,     2,     2,     2,     2,     1,     2,
+     4,     9,     1,     3,     1,     1,     1,     6,     0,     2,     3,     2,
+     1,     1,     5,     1,     3,     1,     5,     1,     1,     1,     1,     0,
+     5,     2,     2,     4,     3,     1,     1,     1,     4,     3,     3,     1,
+     2,     1,     1,     2,     1,     4,     0,     1,     0,     4,     1,    15,
+     1,     0,    10,     1,     1,     9,     2,     4,     1,     1,     0,     2,
+     2,     1,     1,     7,     1,     2,     1,     6,     1,     3,     1,     1,
+     4,     1,     4,     1,     4,     1,     1,     1,     2,     5,     2,     2,
+     1,     1,     0,     1,     0,     2,     1,     4,     8,     2,     1,     0,
+     1,     2,     1,     1,     1,     1,     1,     4,     2,     1,     1,     0,
+     1,     1,     2,     0,     9,     0,     1,     1,     7,     1,     1,     1,
+     1,     1,     1,     2,     2,     8,     1,     1,     1,     2,     1,     2,
+     1,     4,     1,     1,     1,     3,     3,     2,     1,     3,     8,     1,
+     2,     3,     4,     4,     1,     1,     1,     1,     1,     1,     1,     1,
+     1,    10,     1,     3,     2,    10,     2,     2,     1,     1,     4,     0,
+     1,     2,     2,     1,     1,    12,     2,     1,     2,     1,     1,     2,
+     2,     2,     2,     3,     9,     1,     1,     2,     2,     1,     8,     3,
+     9,     3,     4,     0,     2,     3,     2,     0,     3,     2,     1,     1,
+     0,     1,     1,     3,     0,     5,     2,     1,     3,     1,     2,     1,
+     2,     1,     2,     5,     1,     1,     1,     0,     7,     1,     1,     2,
+     3,     0,     5,     1,     3,     5,     6,     1,     2,     2,     1,     1,
+     4,     5,     1,     1,     1,     1,     1,     5,     2,     1,     3,     5,
+     1,     0,     1,     1,     2,     2,     7,     3,     2,     3,     1,     2,
+     4,     0,     1,     2,     4,     1,     1,     0,     0,     3,     4,     1,
+     1,     2,     1,     2,     2,     1,     1,     0,     1,     1,     1,     3,
+    10,     1,     1,     1,     1,     6,     1,     1,     1,     3,     3,     2,
+     1,     5,     3,     1,     4,     1,     1,     1,     1,     1,     0,     1,
+     0,     1,     1,     4,     0,     4,     1,     1,     4,     1,     3,     2,
+     2,     5,     5,     1,     0,     3,     8,     6,     2,     1,     1,     5,
+     5,     3,     4,     1,     1,     1,     3,     1,     2,     3,     2,     4,
+     1,     2,     3,     2,     4,     1,     2,     1,     4,     3,     1,     2,
+     1,     2,     2,     5,     7,     2,     1,     0,     2,     8,     4,     0,
+     2,     0,     4,     0,     1,     1,     0,     4,     1,     1,     1,     4,
+     2,     1,     1,     1,     1,     4,     2,     3,     1,     1,     1,     1,
+     1,     2,     2,     2,     1,     3,     1,     4,     3,     5,     1,     4,
+     8,     3,     1,     6,     2,     1,    15,     0,     2,     5,     2,    12,
+     6,     1,     2,     1,     1,     1,     1,     1,     2,     2,     1,     1,
+     1,     4,     5,     2,     2,     2,     1,     1,     1,     1,     2,     0,
+     0,     1,     1,     1,     1,     2,     2,     2,     0,     6,     5,     2,
+     4,     2,     2,     0,     1,     2,     1,     2,     6,     2,     2,     0,
+     2,     5,     0,     1,    16,     1,     7,     4,     0,     1,     4,     2,
+     1,     6,     1,     3,     3,     1,     2,     2,     0,     1,     1,     1,
+     1,     1,     1,     3,     4,     2,     4,    10,     2,     1,    14,     2,
+     2,     1,     1,     2,     3,     1,     0,     0,     2,     0,     2,     1,
+     1,     5,     4,     2,     2,     4,     5,     4,     2,     2,     1,     1,
+     1,     1,    23,     2,    10,     1,     3,     1,     2,     0,     1,     3,
+     0,     1,     0,     1,     5,     2,     5,     0,     2,     5,     2,     3,
+     1,     0,     7,     2,     3,     1,     1,     1,     1,     4,     2,     3,
+     1,     2,     3,     3,     2,     3,     3,     4,     2,    24,     3,     2,
+     0,     8,     3,     1,     2,     2,     4,     1,     1,     7,     1,     1,
+     1,     2,     1,     7,     6,     0,     1,     1,     6,     1,     1,     2,
+     3,     1,     3,     2,     1,     2,    12,     2,     4,     0,     2,     1,
+     0,     1,     7,     1,     0,     3,     7,     2,     3,     3,     4,     1,
+     4,     4,     1,     7,     1,     1,     2,     0,     2,     1,     1,     1,
+     0,     1,     3,     8,     1,     1,     1,     0,     1,     1,     6,     2,
+     0,     1,     1,     1,     1,    11,     6,     3,     1,     3,     1,     1,
+     2,     1,     5,     1,     7,     1,     4,     2,     1,     3,     2,     0,
+     1,     1,     0,     6,     1,     3,     2,     1,     5,     1,     5,     0,
+     2,     0,     2,     1,     1,     1,     1,     2,     1,     1,     5,     3,
+     2,     1,     1,     1,     0,     6,     8,     1,     3,     8,     1,     4,
+     3,     2,     1,     2,     2,     1,     4,     2,     3,     0,     3,     5,
+     2,     1,     1,     5,     4,     1,     4,     6,     0,     1,     1,     5,
+     1,     5,     1,     3,     4,     0,     4,     4,     1,     6,     3,     3,
+     1,     2,     1,     1,     0,     2,     1,     1,     2,     2,     1,     3,
+     1,     3,     0,     1,     1,     3,     1,     1,     3,     3,     4,     0,
+     2,     2,     6,     6,     3,     2,     2,     2,     0,     6,     1,     1,
+     0,     1,     1,     6,     1,     1,     1,     1,     1,     1,     4,     0,
+     2,     1,     2,     4,     1,     3,     2,     1,     0,     1,     1,     4,
+     4,     2,     2,     2,     2,     4,     4,     2,     1,     1,     1,     1,
+     3,     6,     1,     1,     1,     5,     0,     2,     8,     1,     2,     0,
+     1,     5,     9,     0,     3,     2,     2,     6,     1,     1,     1,     2,
+     8,     6,     3,     3,     0,     9,     1,     0,     1,     1,     5,     1,
+     5,     6,     9,     7,     1,     2,     1,     2,     8,     1,     2,     1,
+     1,     3,     0,     3,     2,     4,     4,     2,     0,     6,     4,    17,
+     7,     4,     3,     2,     0,     5,     1,     1,     1,     1,     1,     2,
+     1,     1,     1,    10,     2,     1,     2,     4,     2,     2,     7,     3,
+     1,     2,     1,     5,     1,     1,     3,     3,     3,     1,     1,     2,
+     1,     2,     9,     1,    14,     2,     3,     4,     0,     2,     4,     3,
+     8,     1,     4,     1,     0,     1,     1,     1,     1,     1,     3,     6,
+     1,     1,     2,     1,     0,     2,     1,     1,     3,     0,     0,     2,
+     1,     6,     1,     3,     0,     3,     1,     5,     0,     0,     2,     1,
+     1,     2,     3,     5,     1,     4,     3,    11,     3,     0,    10,     1,
+     7,     2,     5,     0,     6,     1,     2,     1,     3,     1,     0,     1,
+     1,     7,     0,     4,     3,     1,    10,     1,     3,     1,     7,     1,
+     2,     3,    10,     0,     4,     3,     1,     1,     6,     2,     6,     2,
+     1,    18,     1,     2,     5,     2,     2,     1,     0,     4,     3,     2,
+     1,    11,     1,     3,     2,     6,     1,     1,     1,     0,     0,     1,
+     3,     2,     4,     1,     1,     1,     1,     1,     2,     8,     1,     1,
+    12,     1,     3,     4,     1,     1,     5,     3,     1,     5,     2,     2,
+     2,     7,     2,     8,     1,     1,     5,     4,     7,     1,     0,     5,
+     4,     7,     2,     3,     1,     0,     6,     2,     2,     1,     3,     8,
+     3,     1,     2,     0,     1,     7,     1,     1,     1,     5,     1,     3,
+     2,     2,     6,     2,     1,     1,     3,     2,     1,     5,     6,     5,
+     1,     1,     7,     5,     4,     1,     1,     0,     8,    11,     2,     1,
+     5,     2,     1,     1,     2,     1,     2,     1,     2,     1,     2,     1,
+     2,     1,     2,    12,     5,     5,     2,     4,     1,     9,     0,     1,
+     4,     4,     5,     1,     3,     1,     1,     9,     1,     1,     9,     3,
+     4,     2,     1,     2,     1,     1,    10,     0,     2,     3,     9,     1,
+     1,     1,     4,     0,     1,     4,     2,     2,     4,     1,     1,     7,
+     2,     8,     2,     7,     5,     3,     1,     3,     1,     1,     4,     5,
+     2,     4,     1,     1,     6,     2,     3,     4,     3,     3,     2,     3,
+     2,     2,     2,     4,     1,    16,     6,     1,     1,     4,     4,     3,
+     1,     5,     2,     1,     1,     3,     2,     7,     2,     4,     2,     8,
+     7,     3,     5,     1,     0,     1,     9,     5,     1,     3,     3,     0,
+     1,     7,     8,     1,     1,     2,    10,     1,     0,     4,     2,     1,
+     1,     2,     3,     1,     2,     3,     4,     2,     1,     2,     0,     4,
+     3,     2,     0,     2,     3,     1,     3,     8,     2,     2,     4,     2,
+     1,     1,     0,     1,     3,     1,     0,     2,     1,     1,     1,     3,
+     3,     3,     1,     2,     6,     6,     2,     1,     2,     0,     3,     2,
+     4,     0,    14,     3,     2,     2,     4,    14,     2,     5,     6,     2,
+     1,     3,     1,     1,     4,     5,     1,     0,     2,     8,     2,     4,
+     3,     0,     0,     4,     1,     1,     1,     1,     5,     3,     1,     4,
+     6,     0,     5,     1,     4,     4,    14,     7,     1,     1,    11,     2,
+     1,     3,     2,     1,     4,     1,     1,     1,     2,     7,     0,     5,
+     2,     1,     3,     0,     5,     1,     6,     2,     4,     2,     4,     5,
+     2,     3,     2,     9,     2,     3,     1,     1,     1,     3,     2,     1,
+    14,     2,     1,     2,     3,     2,    17,     5,     1,     2,     6,     2,
+    10,     1,     1,     2,    16,     5,     2,     2,     1,     3,     5,     2,
+     2,    11,     1,     1,     3,     0,     3,    10,     6,    11,     3,     1,
+     5,     1,     1,     4,     1,     1,     1,     4,     1,     7,     0,     4,
+    26,    12,     1,     6,     2,     0,     2,     0,     1,     6,     3,     4,
+     1,     3,     1,     0,     3,     1,     1,     0,     5,     3,     7,     0,
+     0,     1,     3,     1,     2,     1,     5,     2,     1,     1,     2,     2,
+     0,     2,     1,     1,     3,     2,     2,     2,     5,     2,     5,     5,
+     2,     2,     2,     1,     4,     4,     5,     2,     3,    10,     1,    16,
+     5,     0,     4,     4,     1,     3,     0,     8,     2,     3,     1,     1,
+     4,     4,     2,     2,     1,     5,     5,     4,     2,    12,     0,     5,
+     1,     3,     0,     3,     1,     8,     2,    15,     2,     6,     1,     1,
+     2,     5,     4,     7,     1,     3,     5,     3,     1,     4,    12,     1,
+     2,     7,     4,     2,     2,     1,     0,     4,     1,    18,     1,     4,
+     1,     1,     1,     3,     4,     4,     4,     3,     1,     0,     0,     1,
+     6,     1,     2,     2,     3,     1,     4,     3,     1,     1,     1,     0,
+     2,     4,     5,     1,     3,     3,     0,     1,     3,     4,     2,     1,
+     1,     0,     3,     2,     2,     2,     3,     3,     2,     2,     8,     0,
+     2,     3,    12,     8,     2,     2,     1,     0,     6,     2,    13,     3,
+     8,     1,     7,    10,     3,    10,     5,     1,     3,    16,     2,     9,
+     4,     4,     0,     6,     5,     0,     2,     1,     2,     1,     1,     4,
+     4,     4,     5,    10,     3,     1,     5,     5,     7,     7,     1,     4,
+     2,     3,     0,     4,     3,     2,     2,     0,     1,     0,     1,     3,
+     0,     8,     8,     7,     0,     4,     0,     3,     6,     8,     2,     3,
+     1,     6,     5,     4,     2,     6,     2,     1
+};
+
+static const int16_t keyword_hash_slots[] = {
+ 4204, 4239,   -1, 1085,   -1,  507, 2748,   -1,   -1,   -1, 4402, 1329, 1963, 3877, 4356, 1222,
+   -1, 2978, 1144, 2035, 3884, 4743,   -1,  491, 4303,   -1, 4490, 2291,   -1, 2377,   -1,   -1,
+   -1, 1067,   -1,   -1,   -1,   -1,   -1, 1706,  390, 1282, 1221,   12, 3674, 1789, 2469,   -1,
+   -1, 2873,   -1, 2990,   -1,   -1, 2976, 3960, 3561,   -1,   -1,   -1, 3886,   -1,   -1, 3185,
+ 2745,   -1, 4410, 3425, 2739,  453,   -1, 3892,   -1,   -1, 2355, 2746,   -1, 3762, 4685, 1606,
+   -1,  999,   -1,   -1,   -1, 1016,   -1,  800, 3216,   -1, 2563, 3168,  132, 1444,  775,   -1,
+  808,   -1,  156,   -1,  594,   -1,   -1,  501,   -1,   -1, 4046, 3885, 3041,   -1,   -1, 1663,
+ 3458, 4005, 1740, 3404, 4077, 2230, 4169, 3025,   -1,   -1, 4057,   -1,   -1,   -1, 2843, 2375,
+   -1,   -1,  267, 1256, 4604,   -1, 2133,   -1, 3235,   -1,   -1, 3732, 2612, 1519,   -1,   -1,
+ 1233, 2200,   -1, 4345, 1697, 1704, 3850, 4263,   -1, 3786,  200,   -1, 2101,   -1, 4806, 4097,
+   -1, 1160,   -1,  563, 1585,   -1,   -1, 4008, 2278,   -1,   -1,   -1,   -1,   -1, 2184, 3259,
+   -1, 3380,   -1,   -1,  567,   -1,  977,   -1,   -1,   -1, 4629,   -1,   -1, 4200,   -1, 2250,
+   -1,   -1,   -1, 2592, 1021, 2514,  865,   -1, 1055, 2527, 3680,   -1, 3136,   -1,   -1,   -1,
+ 2545, 2886,   -1, 4075, 3834, 1881,   -1, 1078, 3105, 2342, 1432, 2273, 1389,   -1,  569,   -1,
+ 2021,   -1,   -1,   -1, 1611,   -1,   -1, 4235, 4735,  760,   -1,  226,   -1, 2192,  661,   -1,
+   -1, 1030, 4299, 4272,   -1,   -1, 1895, 4031, 2868,   -1,   -1, 3077,   -1,   -1,   -1,  398,
+ 4185,   -1, 1840,   -1,   76,   -1, 3187, 2859, 3912, 3176,  283, 3387, 3275, 2085,   53,   -1,
+ 3192,   -1,   -1,  113, 2927, 2277,  564,   -1, 4182, 4464, 3297,   -1,   -1,  118,  938, 1411,
+   -1, 2303, 3152,  735, 4527, 1313,   -1, 3715, 4736, 4817,   -1, 1469,  167, 4631,   -1,   -1,
+ 1402,  380,   -1,  288, 2397, 2890,  256, 4279,   -1, 3023, 1121,   -1,   -1,   -1, 1142,  259,
+ 3446,   -1, 2126,   -1, 1346,  194,  603, 1165, 2529, 1790, 2307, 3116, 4127,  772,   -1,   -1,
+ 4794, 4256,   -1,   -1,   -1,   -1, 1842, 3790, 3578,   -1,   -1, 2673,  935, 1708,  744, 4013,
+   -1,   -1, 3785,   -1,   -1,   -1, 3874,   -1, 1398, 1429,   -1, 1034, 1243, 3161,   -1, 1220,
+   -1,   -1,   -1,   -1, 1408,   -1, 1044, 1152, 1827, 2426,   -1,   -1,  187, 3359, 3330,   -1,
+   -1,    1, 2269,   -1,   -1, 1922,   -1,   -1, 4156,   -1, 4719, 1828,   -1, 2701,   -1,   -1,
+ 2428,  313,   -1,   -1, 4379, 3567, 3901,   -1, 4293,   -1,   -1, 1337, 3351,  728, 1199, 3423,
+   -1,  969,   24, 1164,   -1, 4067,   -1,   -1,   -1, 1646,   -1, 4478,  682,   -1, 4576,   -1,
+  948,   -1,   -1,   -1,   -1, 3896,   -1,   35, 4839,   -1, 2887,   -1,   -1, 2099,   -1,  154,
+   -1, 1616,  666,  129,   -1, 2380,   -1, 1944, 1994, 3587,   -1, 4613,   -1,   -1, 1130,   -1,
+   -1,   -1,   -1, 4715, 3183,   -1, 1806,   -1, 1045,   -1,   -1, 3614, 1128,   -1, 1107,  529,
+ 3088,   -1,   -1,   -1,   -1,   -1, 3171, 4575,  994,  408, 2123, 4835, 3397,   -1,   -1, 2077,
+ 4543,   -1, 2286,   -1,   -1,   -1,   -1,   -1,   -1, 3714,   -1,   -1, 3972, 3000, 3817,   -1,
+ 3847,   -1, 1810,   -1, 4726, 1498, 3130, 2674,   -1,   -1, 4302,   -1, 1979, 4691,   -1,   -1,
+   -1, 4517, 3718,   -1,   58,   -1, 4635, 2853, 3022,   -1,   -1, 4221, 2531, 2290, 3044, 2543,
+ 1608,   -1, 3713,   -1, 3001,   -1, 2488, 4105, 3333, 2446, 4653, 3396, 1094, 4694, 3495,   -1,
+ 2066,   -1,   -1, 4512,   -1,  674,   -1,   -1,  233, 3961, 1705, 4391, 2432,  355,  955, 2512,
+ 2010,   -1, 3482, 3730,   -1, 1723,   -1, 2462, 1538,   89,   -1,  828, 4069, 1582, 2953,  675,
+   -1, 3937,   -1, 3160, 2476,   -1,   -1, 1664,   -1,   -1,   -1,  339,   -1, 3342,   -1,   -1,
+   -1, 1953,  261,   -1, 4822,   -1, 3289, 3361,  498,   -1,   -1, 4363, 1859, 1894,   -1,   -1,
+ 3736, 2072,   -1,   -1, 2183, 1031,   -1, 3247, 2201,   -1, 3772,   -1, 2639,  433,   -1,   -1,
+ 1554, 4669,   -1, 3178, 3165, 3188, 1161, 2328,   -1, 4238, 4207,   -1, 3293, 1503,   -1,   -1,
+   -1,   -1, 2256, 1670,   -1, 4816, 1265, 1680,   -1,   -1, 2620,   -1, 4746, 3475,   -1,   -1,
+   -1,   -1, 3793,   -1,   15, 2196, 3343,   -1,  466,   -1,   -1,   -1, 4292, 3451,   -1,  609,
+  859, 3322,   -1,   -1,   -1, 4342,   -1,   -1, 2895, 3945, 3225,   -1,  409,   -1,   -1,   -1,
+ 1655,  191,   -1, 2635,   -1, 2646,   -1,   -1,   -1, 2444, 4714, 1089, 2310,   -1, 1550, 4813,
+ 4731,   -1, 3058, 1701,   -1,  294,   -1, 1982,  989,   -1, 2931, 2063, 4820,   -1,  814,   -1,
+ 1551,   -1, 1049, 1804,   -1, 4171,   -1,  396,   -1,   -1,   -1,   -1, 3298, 3305, 3233, 3020,
+ 2237, 4481, 4704,   -1,   -1,  461, 3583, 1092, 2311,   -1,   -1,   -1, 4066, 4662,  117, 1958,
+   -1,   -1,   -1, 2132, 2025,   -1, 3196, 3332,   -1, 1410, 4212,   -1,  373,   -1, 1167,   -1,
+ 3198, 2086, 1685,   -1, 1464, 1904, 3812, 3122, 1793, 2908, 1717,   -1,  370, 3019, 4840, 3698,
+   -1,   -1, 3381,   -1, 2020, 4336, 2001, 2958,  926,   -1,   -1, 3763,   -1, 4680, 1271,   -1,
+  780, 2833, 2159, 1544, 4248,   -1, 3808, 1581,   -1,   -1, 1911, 2716, 3320, 2338,   -1,  497,
+  318, 1591,   -1,   -1, 3751,   -1,   -1, 4360, 4009, 3955,   -1,   -1, 4760,   -1, 2202, 3206,
+   -1,   -1,   -1,   29,   -1,   -1, 2490,   -1, 2860,   -1,   13,   -1, 2105, 3501,  885,   -1,
+ 2968,   -1, 3256,  848,   -1, 2298,   -1,   54,   -1, 1206,  970, 1583,   -1, 4359,   -1, 3239,
+   -1,   -1,   -1, 2567,   -1,   -1,  557,   -1, 3244, 4553, 1000,   -1,   -1, 4158, 2235,   -1,
+ 2903, 3104, 2813,  371, 3374, 3770, 1382, 2258,  580,   -1,   -1,   -1, 1134, 4074, 3635, 4000,
+   -1,   -1,  840,   -1, 1936,   -1, 1932,   -1,   -1, 3909, 2423, 4636,   -1,   -1,   -1,   -1,
+   -1,   -1, 1700,   66,   -1, 1573, 4095, 2089,   -1,   -1, 2954, 4544,   -1, 1040, 4702, 3314,
+   -1, 1099,   -1,  752,   -1,  762,   -1, 2075, 1299, 1787, 3560,   -1, 1304,   -1, 3170,   -1,
+ 3992, 4722, 1730,   28, 4634, 1753,  692,  918,  404,   -1,   -1,  659,   -1, 2708,   -1,   -1,
+   -1,   -1,   -1, 2998, 1219,   -1,  471, 1433,  939, 1063, 1109, 4476,   -1, 1353, 1541,   -1,
+ 1026,   -1, 2831, 4800,   -1, 3011,   -1, 4438, 4614,  435,   -1, 2102,   -1, 2820, 1201,   -1,
+  782,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  702, 4725,  425,  295,   -1,   -1, 3254, 1928,
+ 3862,   -1,   -1,   -1, 2203, 2949,  881,  382,   -1, 4312, 3878,   -1, 3959, 2779,   -1,   -1,
+ 3859,   -1,   -1,   -1, 4492, 4117, 3034, 1703,   -1,   -1,   -1, 2106, 1060, 2022,  204,   -1,
+ 3663, 1566, 4372,   -1, 2945, 4756,   -1,  642,   -1, 3836, 1175, 4225,  719, 2486, 4732,   -1,
+  579,  802, 2993,   -1, 2417,   -1, 3628, 3654, 2137, 2972, 4447, 3623, 3346,   -1,   -1,   -1,
+ 1327, 2187,   -1,  284,   -1,   -1,   -1,   -1,   -1, 1369, 1570, 1131,   -1,   -1,  971,   -1,
+ 1404, 2683, 3531,   -1,   -1, 3656,  319, 2700, 2013,   -1,   -1, 1684, 3761, 2692,   -1,   -1,
+ 2932, 2336,   -1,   -1,   -1, 1157, 3927, 2805, 4080, 2079,   -1, 3119, 2098, 4581, 2208,  189,
+ 3006,  981, 3059, 1688,   -1, 1892, 3393, 4455, 1542,   -1, 3940,   -1, 2468,   -1, 3990, 2796,
+   -1,   -1,   -1, 1621, 1900, 2560, 2596,   -1,   -1, 4240,   -1,   -1, 2152, 4284,   -1, 3841,
+   -1,   -1, 2951, 3246,   -1, 3891,  740,   -1,   -1, 3818, 2309, 2374,   -1,   -1,   -1,   -1,
+ 3109,   -1,   -1,   -1, 4058,   -1, 1260,   -1,   -1,  420, 2506,   -1, 4642, 3068,   -1,   -1,
+ 3145, 4103, 2266, 2242, 1650, 4083,  455,   -1,  411, 3069,  418, 1699, 1250, 4654,   -1, 4566,
+  159, 4085,  965,   68, 2780,   -1, 2902,   -1,   -1,   -1, 3721,  685, 3989,   -1,   -1, 3483,
+   -1, 1069, 2050,  258,   -1, 1381,   -1, 1511, 3219,   -1,   -1,   -1, 1876, 4398, 4638, 3433,
+ 1831, 3070,  236,  883, 3563, 1029, 4230,  462, 1758, 3733, 1071,   -1,   -1, 3571,   -1,   -1,
+   -1,   -1,   -1, 4128, 1943, 3670,   -1, 4828, 1154,   -1,   -1, 4062, 4317, 1986,   -1,   -1,
+   -1, 2909,   -1, 1344,  645, 1809, 1006,   -1, 1468, 3494,  155, 2351,   -1,  164,  528,   -1,
+  658,   -1, 1561,   -1,   -1,   -1,   -1, 3468,   -1, 2240,   -1, 2396, 3383,   -1,   -1,   -1,
+ 1743, 3047, 2312, 3071,   -1, 3414,   -1, 3613,   -1,   -1, 1082,   -1,   -1, 1279, 2453, 2806,
+ 3237, 1198,   -1, 3659, 1446,   -1,   -1, 3306, 3789,   -1, 2045,  436, 1440,   -1,   -1,   -1,
+   -1, 4809,  649,   -1, 2728,  784, 3958,   -1,   -1,   -1,   -1,   -1,  458,  490,   -1, 2546,
+ 3473,   -1,  126,   -1, 3810, 3151,   -1,   -1,   -1,   -1, 4596,   -1,   -1,   -1,  904,   -1,
+ 1934,   -1, 4149, 4496, 4632, 4713, 3533, 4439,   -1, 3080,   -1, 3529,   -1, 1930, 3267, 2191,
+   -1, 4081, 3843, 4798,   -1, 1642, 3863,  783,   -1, 1691, 1251,   -1,  218,   -1, 1954,   -1,
+   -1, 1604,  260,   -1,   -1,   87, 1421, 3016,  500,   -1,   -1,   -1,   -1,   -1,  934, 4836,
+ 4329,  340, 1181, 1463,   -1,   -1, 3636,   -1,   52,   -1,   -1,   -1, 1572,   -1,   -1,   -1,
+   -1,   -1, 4617,   -1, 1357,   -1, 2889, 1140, 2659, 3212,   -1, 2186,   -1, 4039, 3516,  648,
+ 3815,   -1,   -1, 3138, 2586, 4830, 1240,   -1, 4518, 2550, 4419,   -1, 1112,   -1,   -1, 1234,
+  790,  426, 3535, 4208, 4843, 1727,   -1,   -1, 1351, 4774, 4723, 4562,   -1, 4133,   -1, 3645,
+ 4250, 2094,  788,  451,   -1,   -1, 3052,   -1, 1865,   -1,   -1,   -1, 1007,  986,   -1, 2781,
+ 4456, 4003,   -1, 4539,   -1,  812, 3415, 2081, 2992,  695, 2602,  757,   -1,   -1, 1070, 4804,
+ 1813, 1223, 2036, 2321, 1741, 1272,   -1,  349, 4457, 2053,   -1,   -1, 1013,   -1, 2284, 2944,
+ 3932,   -1,   -1,   -1,   -1,   -1, 1184, 3833,   -1,  827,   -1,   -1, 1264,   -1, 2378, 2412,
+   -1, 3307, 4808,   -1,   -1, 4842,   -1,   -1, 2520, 3777,   -1,   -1, 3778, 1966,   -1,  669,
+  640,   -1,   -1,   -1, 3302,   -1, 1985,   -1, 4093,  326,   -1,  352,   -1,  731,   -1, 3177,
+ 4825,   -1,   -1,  516, 4470,   -1,   -1, 3417,  611, 2822, 4623,   -1, 1649,   -1,   -1,   -1,
+   -1,   -1, 4413,  416,   -1,  515,  212, 2600, 4673, 1409, 4511,   -1,   -1, 2259,  657, 1135,
+   -1, 4269, 4324, 3113, 1835, 2400,   -1,  476,  539, 4493,   -1, 4136, 2749,   -1,   -1,   -1,
+  711, 2882,   -1,   -1, 2548,   -1, 2892,   -1,   -1,   -1, 4647, 2214, 3703, 4051,   -1,   -1,
+   -1,  930, 1845, 3712,   -1,   -1, 1907,  478, 2867,   -1,   -1, 4430,   -1, 1713, 2026,   -1,
+ 1127,   -1, 2742, 2341,   -1,   -1,   -1, 4650,   -1,   -1,  896, 1288,   -1, 2801, 4353, 3234,
+ 3243,   -1, 4141, 4314,   -1, 1962,   -1,   -1,   -1,   -1, 2848, 2448, 2251,   -1, 2038, 4394,
+ 3409,   -1,   -1, 3897,   -1, 4606,   -1,  193,   -1, 3822,  165,   -1, 4420, 1576, 3603,  596,
+ 4554,   -1,   -1,   -1,  941, 2553, 1517,  381, 4567, 4703,   -1,  932,   -1, 1500,   -1,   -1,
+   -1,  112,   -1, 3406, 4384,   -1, 1207, 2420, 3609, 4316, 2460, 1497, 4086,   -1,  512, 2642,
+ 1826,   -1,   -1, 1669, 4701,   -1, 4741,   -1,   -1, 2574,   -1,  338,   -1, 4565, 2120, 3970,
+ 4522, 4487,   -1, 3362,  413,   -1,   -1, 4667, 4516,   -1,   -1, 1563, 4354, 2253,  668, 1430,
+   -1,  959, 3622, 2928,   -1, 1015,  249, 2786,  201,   -1, 2111, 3873, 3159,   -1,   -1, 1897,
+  815,   -1, 2294,   -1,   -1,   -1, 1501, 2658,   -1, 3255, 4043,   -1,   -1, 4223, 1438,  908,
+   -1,   -1,   -1, 4380,   -1,  886,  270,  457,   -1,   -1,   -1, 3111, 2155, 4305, 4211, 3092,
+ 4710,   -1,   -1,   -1, 1885,   -1,   -1, 3941, 2973,   -1,   -1, 4740,   -1, 3035, 2097, 2507,
+   -1,  978, 1844,   -1,   -1,   -1,  119, 2647, 3787, 1236, 4812,   -1,   -1,   -1,   -1,   -1,
+   -1, 3204, 3572,   -1, 1190,   -1,  915,   -1,   -1, 1657,   -1, 2778,   -1,   -1, 3842,   -1,
+ 2819, 1473, 4525, 3588, 3838, 4480, 2179, 4104,   -1, 2037, 2418,   -1, 4672, 2946, 2082,  530,
+ 2730,   -1,   -1, 2409,   -1, 1644,  718,   -1,   -1,   -1,  937, 1079,  203, 1562, 4351,   -1,
+  644,   -1,   -1, 3865,   -1, 1180, 1417,   -1,   -1,   -1, 4727, 4217, 1068,   -1, 2165, 4805,
+ 4151, 1305,   -1,   -1,   -1,   -1,   -1,   -1, 1200,  745,   -1,   -1,  514,   -1, 1761, 3309,
+   -1, 4448,  353,   -1,   -1,   -1, 1176, 1974,   -1,   -1,  741, 1765,   -1,   -1, 1769,   -1,
+   -1,   -1, 1838, 3249, 1909,  610,   -1, 4309, 2726, 2044, 3449, 4090, 4497, 4833, 3671, 3102,
+  847, 3555,   -1, 2238, 3632, 1147,   -1,   -1, 2287,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1, 3908,  797, 2724, 2067,   -1,   -1, 3644, 1090,   -1, 4274, 4622, 1919, 2211, 3964,
+   -1, 2770, 3472, 1268,    5, 1547, 1973,   -1,  561, 1249,   -1,  947, 4495, 3910,   -1,   -1,
+   -1, 1014, 4751,   -1,   -1, 1182,   -1,   -1, 2002, 1829, 1259, 4763,   -1,  936,   -1,  538,
+   -1,  722,   -1,   -1, 1976,   -1, 2154, 2424,  777, 2435,   -1,  972,   -1, 2231, 3153, 4386,
+ 3232,  492,   -1,  637,   -1, 2947, 1333,   -1,   -1, 4537,  588, 2818,   -1, 3066,   -1,   -1,
+   -1,   -1,   -1,   -1, 2280, 4393, 4780, 2503,   -1, 3456,   -1, 4228,   -1,  898,   -1, 4015,
+   -1, 3172,  531, 2161,   -1,   -1, 1039, 4661, 3618,   -1, 4123,   -1,   -1,   -1, 2283, 3595,
+ 1788, 1009, 3348, 2970, 4411,   -1,  322,   -1, 4339, 3063,   -1,   -1, 2470, 4026,   -1, 2772,
+ 4162,   -1, 2006,   -1,   -1, 3515,  761, 4461,   -1, 2777, 4700,   -1, 2955,   -1,  586,  149,
+  621,  536, 2100,   -1,   -1, 3429, 2030,   -1, 4267,   -1,   -1,   -1, 2934, 1229, 4226, 1624,
+   -1, 2372, 3175,   -1,   -1, 2547, 2518, 4533, 4254, 4334,  882,   -1, 2074,  975,   -1, 3005,
+ 4333, 1490,   -1,  342, 4724,   -1,  636,   -1, 4403, 2436, 1005,   -1, 3693,   -1,   -1, 2427,
+ 2880, 2755, 4463,   -1,   -1,   -1, 3963, 3365,   -1,   -1, 4778, 1896,   -1,   -1, 3079, 3242,
+   -1, 2776,  710,  452, 4425,   -1,  724,   -1,  931, 4109,   -1,   -1,   -1,   -1, 2866,   -1,
+  423,  196,   -1, 2804,   -1, 4462, 4065, 1671,   -1, 3202,  161,  447,   -1,   -1, 3986,   -1,
+   -1,   -1,   -1, 1682,   34, 1017, 2207,   -1, 1189,   -1,   -1,   -1, 2595,  643, 2963, 2112,
+ 4059, 3651,  845, 4399, 2879, 2764, 1244,   -1,   -1, 1388,   -1,   -1,   -1, 4408,   -1,   -1,
+   -1, 2484,   -1,  806, 1679, 2084,   -1, 2718,   -1,   -1, 2719, 2983, 4769,   -1,   -1,   -1,
+ 2975,  766, 1022, 4114,   -1,   -1,   -1, 2151,   -1,   -1, 1064,   -1, 3463, 3257, 4737,  438,
+   65, 1284, 2610, 4355,  905,   -1, 4687,  534, 3870,   -1,   -1,   -1, 3453, 3928,   -1, 3203,
+ 1075, 1374,   -1, 4341, 1991, 2465,   -1,   -1, 3002, 2544,   -1, 4773, 3631, 3903,   -1,  821,
+ 3835,  365, 2124,   -1,  422,   -1,   -1,   -1,   -1,   -1, 3478, 4155,  732,  570,   -1, 2354,
+ 3683, 1931,   -1,   -1,   -1,   -1, 1861, 3158,   -1, 4107,   -1, 1715, 4199,   -1,   -1, 1177,
+ 4172,   -1, 4218,   -1, 4595, 2938, 2706, 2177,  796, 2389, 4056,   -1,   -1,   -1,   -1, 1641,
+ 2571,  646,   -1,   -1,   -1, 2794, 2982,   -1,   -1,   -1, 3497, 4237,   -1,   -1, 3248,   -1,
+   -1,  186,  402,  739,   -1,  816,  449,   -1,   -1,   -1,   -1, 2663, 1731,   -1,   -1,   -1,
+   -1, 1479, 2379, 2790,   -1, 2497, 3045,   -1, 3696,   -1, 4442, 2883,   -1,   -1, 4466,   -1,
+   -1,   -1,   -1,   -1, 1186, 3738, 3452,   -1,  625, 1945, 2870, 3828,   -1, 1805, 4206,  181,
+   -1, 2220, 1339, 4307, 1437,  667,   -1, 2325, 4655, 1011, 2803,  595, 4392,   -1, 2871, 4028,
+   -1, 2041,  652, 3700,   -1, 2562,   -1,  924,   -1, 4814,   -1, 4098, 3164, 3969, 1312,   -1,
+ 2217,   -1,  532,  442, 1719,   -1,   -1, 3973,   -1,   -1, 3985, 2463, 4601,   -1,   -1, 1012,
+ 3581,   -1, 2103, 4799,  583,   -1,   -1,   -1,   -1,   -1,   -1, 1326,   -1, 1745,  297,   -1,
+ 2049, 3007,   -1,   -1, 3251, 2398,   -1, 2477, 3997, 3335,  671,   -1,   -1,   -1, 1420,   -1,
+   -1,   -1, 1643, 3382,   -1,  781,  243, 1397,   40, 2721, 2301,   -1, 3668,   -1, 4529, 1385,
+ 1010,   -1,   -1, 1502,   -1,   -1,   -1,   -1, 3341,  764, 2566,  362,   -1, 1428,  686,   -1,
+ 2489,   -1,   -1,  168,   -1,   -1, 4793, 1921,  921,   -1,   50,   41,   -1,   -1,   -1, 4135,
+  857, 2920,   -1, 1873, 4195, 2289,   -1,   -1,   -1, 3575, 3230, 2622,  509,   -1, 3593,  589,
+ 4718, 4331,   -1,  987, 2254, 2671, 1066, 2858, 3868,   -1, 3193,  278,  317, 1149, 4409, 1660,
+   -1,   -1, 4131,   -1,   -1, 1230,   -1,   -1, 2362, 2751,   -1, 2054, 2530,   -1,   -1, 3646,
+   -1, 4245,   -1, 2182,  630,  552,   -1, 3273, 4252, 3261, 2243,   -1,   -1, 4730,   -1, 4583,
+   -1, 4271, 3522,   -1, 2430,  545,   -1, 1760,   -1,   -1, 4761, 1689, 1228, 3222,   -1,   -1,
+ 2138, 3900,   -1,   -1,  665, 1261,   -1,   -1,  238, 3548, 3154, 1488, 3687, 4234,   -1, 3562,
+   -1,   -1,   -1, 2228,   -1, 3428,   -1,   -1,   -1, 1751,   -1,   -1, 1035,   -1, 1632,  725,
+   -1,  907, 2068, 1696,   -1, 3782,  773,  421, 1640, 3731,  227, 1141, 1435, 1594,   -1,  617,
+   -1,   -1,   -1,   -1,   -1,   -1,  464,    9, 2670, 2640,   -1,   -1,   -1, 2064, 2358, 2224,
+   -1,   71, 2376, 4119, 1863,  809, 4678,   -1, 2852, 3740,   -1, 3126,   -1,   -1,   -1, 3775,
+ 4747,   -1, 2267,  976,   -1, 3725,   -1, 4383, 1386, 1419, 1471,   -1,   -1, 3924,   -1, 2346,
+ 2837,   -1,   -1, 4054,   -1, 3313,  834,  763, 3717,   -1, 1062, 1330, 1613,   -1, 3902,   -1,
+ 1989,  993,   -1,   -1,   -1, 1277,   -1, 1512,   -1, 1470,   -1, 3338, 1193,  184,   -1, 1491,
+ 2810, 2713,   -1, 1772,   -1, 3143,   -1,   -1,   -1, 2759,   -1,   42,   -1, 3265,   -1,  513,
+  554, 2056,   -1, 2483,   -1,  448,   -1,   -1,   -1,   -1,   -1, 4656, 1886, 2193,   -1, 3258,
+  892, 2458,   -1,   -1, 2171, 2285,   -1, 1915,   -1, 4572, 4120,  143, 3395, 1814,  734,   -1,
+   -1,   -1,   -1,   -1, 4209, 4328, 1372, 3749, 3173, 1179,   -1, 3469, 4503, 1884,   46, 1625,
+ 4344,   -1, 2816, 1506, 3802,   -1, 3327,  713,   -1,   -1,  768,   -1,  688, 1942,  407,  749,
+ 3596,   -1,   -1, 3965, 3435,   -1,  324, 3741,   -1,   -1,  104, 1462,  344, 1990,  572, 4670,
+  488,   -1, 3954, 2219,   -1, 3925,  656,   -1,   -1, 1693, 4111, 3780,   -1,   -1, 4010, 1425,
+  192, 1188, 2540,   -1, 1037,   -1, 3545,  282,  543,   -1,   -1, 2421,  412, 4698, 1338,  998,
+   -1,   -1,   -1,  440, 4707, 3127,   -1,   -1, 4163,   -1,   -1,  841, 4125,   -1,   -1,  795,
+  592,   -1, 1721, 2919,   -1, 4716, 2817, 3506,  114,   -1,   -1,   -1,    7,   -1,  903,   -1,
+  542,  553, 3347, 2711, 1565, 4311,   -1, 1912,   -1, 1546,  331, 3073,  511, 3489, 3978, 4692,
+ 4198, 4585,   -1,   -1,   -1,   -1,   -1, 1908,   -1, 2261,   -1,   -1,   -1,   -1,   21,   -1,
+ 4472, 2450,  799, 3977, 1476,   -1, 1849, 3695,   -1, 4404,   23, 2160,  601, 3711, 4582, 1999,
+ 3086,   -1, 2322, 1115,   -1, 3939,   -1, 3754,   -1,  879, 4474,   -1, 3638, 2313,   -1, 3539,
+ 1042, 1628,  943, 3358, 2735, 4291,   -1,   -1, 2981,   -1, 1678,  863, 3719, 2057, 4132,  470,
+ 4153, 4397,   -1,  587,   -1,   -1,   -1,  145,   -1, 2109,   -1,  241,   -1,  638,   -1, 1525,
+   -1,   -1,   -1, 3360, 4006, 4664,   -1, 4782,   -1,  963, 2617, 3849,   -1,   -1, 4282, 2093,
+ 2185,   -1,   -1, 3569, 2707,  368,   -1,   -1, 1515, 1395,   -1, 3994, 3224,   -1,   -1, 3866,
+   -1,  864, 1913,   -1, 1651,   -1, 2589, 1967,   -1,   -1,   -1,  304,   -1, 4101,   -1, 4188,
+   -1, 3205,  681, 4649, 2144,  432, 2715,   -1,   -1,   -1,  131, 3253, 1860,   -1, 4176, 1255,
+ 3181, 3281,  437,   -1, 4076, 4029,   -1, 1365, 1868, 3906, 3218, 3629,   -1, 1343,  872,   -1,
+ 1478,   -1, 1269, 3118,   -1,   -1, 2003,   -1, 1588,   -1,  179, 3760,   -1,   -1,   -1,   -1,
+   -1, 3523, 2900, 1812,   -1,  792, 4286, 2415, 4084,  230,   -1, 2189, 4829,   -1,  144, 2413,
+ 4832, 1960,  655,   -1, 1159, 1368,   -1,  308, 4612,   -1, 2441,   -1,   -1, 3753,   -1,   -1,
+   -1, 1320, 3527, 1239, 1824,   -1,   -1,   -1,   -1,   -1,   -1, 1253, 1424, 3971,   -1, 2616,
+ 3470, 3241, 1380,   -1,   -1,   -1, 4242, 2986,   -1,   -1,  615,   -1, 3336,   -1,   -1, 3542,
+   -1,  264,   -1, 3467,  983,   -1, 3673,   -1, 1614,   -1, 2743,   -1,   -1,   -1, 1111, 3123,
+ 2136,   -1,   -1, 2028,   -1, 3481,   -1,  664, 4440, 2637,  843,   -1,   -1, 2232,   -1,   -1,
+   -1,   -1, 2977, 3604, 2929, 2147,   -1, 3283,   -1,   -1,   -1,   -1,   -1,   -1,  525,   -1,
+ 1825, 1187, 1267,   -1, 2653, 4797, 3660, 1378, 2339, 4683,   -1,   -1, 2625,   -1, 2392,   -1,
+   -1, 4222, 3490,   -1, 3156,   -1,   -1,   -1,   -1, 2018, 2906, 2320, 2604, 2623, 2371, 3564,
+   -1,   -1,  180, 1018,  257,  854,   -1, 3626, 2914, 4173, 3316, 2393, 1635,   -1, 3685,   -1,
+   -1,  951, 2515, 3245,   -1,  460, 2443, 1964,  486,   -1, 4358, 4744,   -1,  303,   -1, 2213,
+   -1, 1270, 1612,   -1, 4290,   -1, 4468,   -1, 1665, 2767, 3727,  855,   -1,   -1,   -1,   -1,
+ 4475,   -1,  568,   -1, 1209,   -1,   -1, 2894, 3290, 2404,   -1,   -1,   -1, 1647, 4377, 1148,
+  902, 4072,  177, 1349, 2209,   -1,   -1, 3110, 4550, 4146, 2762,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1, 2167,   -1,   -1,  698, 3115, 4795, 3394, 1020, 2012,  310,   -1, 2621,   -1, 3804,
+  395, 3323, 1216,   -1,   -1,   -1,   -1,   -1,   -1, 3331,   -1, 4633, 1615, 3920,   -1, 1735,
+ 3054, 2218,   -1,   -1, 1877,  723,   -1,   -1,   -1,   -1, 1872, 3340,   -1,   -1,   -1, 1853,
+ 2738, 4547,  778,   -1,   -1, 4012, 4750,  394, 3890,   -1, 4122,  623, 3250, 4040,   -1, 1053,
+ 2347, 4618, 1088,   -1, 4178, 2974, 4681, 1311,   -1, 4094,   -1, 2206, 2782, 1992, 1362,   -1,
+ 4078,   -1, 2263,   -1, 3640, 2042, 3355, 2631, 2164, 3926, 2677, 2664, 4033, 3692,   -1,   -1,
+ 3128,  481, 3512,  100, 1364, 4421,   -1, 2403,   79, 3521,   -1,  321, 3465, 3916,   -1,   -1,
+   -1, 1294,   -1, 1956, 4300, 1122, 1235,   -1,   -1, 1633, 2564,   -1, 2565, 1242,   -1,   -1,
+ 3980, 2693, 3871,   -1, 2926,   -1, 3299, 1822, 1836, 4431,   -1,   -1, 3801,   -1,   -1, 4626,
+   -1, 1847,  166, 4668,   -1, 1103,  639, 1837, 2923,   -1, 3744,   -1,   -1, 1355, 2702,   -1,
+ 2223,   -1,  705,   72,   -1, 2910, 3236, 4734, 3149,   -1,   -1,  111, 2994,   -1, 2385,   -1,
+   -1, 2839, 2669,   -1,  654,   -1,   -1, 2199,   -1,  813, 1492, 3502,  862, 3030, 2368,   -1,
+ 1950,   -1,   97, 2826,  487,   -1,  527, 3166,   -1,   -1, 4073,    6,   -1,   -1, 4591, 4753,
+   -1, 2922, 3195, 1852, 3544, 3124, 1648,   -1, 1224,   -1,   -1, 1880, 1431, 4126, 4696, 4251,
+ 4055, 3570,   -1,   -1,   -1, 4047,   -1,  444,   -1, 4106,  211, 3214,   -1, 4007, 3262,   -1,
+ 4590, 3447, 2511, 2292,  399, 3881,   -1, 3764, 2031, 4387, 1074,   -1, 4645,   -1,   -1, 3407,
+ 2864,   -1,   -1, 2704, 1869,   -1,   -1,   -1,   -1,   -1,   -1,  952, 1959,   -1, 2388, 3510,
+ 1280,   -1, 2747,   -1,   -1,  450,   -1,   -1,   -1, 2466, 4124,  291,   -1, 4087, 1451, 3913,
+   -1,   -1, 3098, 2798,  868,   32,  618,   -1,   -1, 1590,   22,   -1,  148,   -1,   -1,  170,
+ 3967, 3186, 2835,   -1,   -1,   -1, 1676,   -1,  302,  197, 1668,  793,   -1,   -1,  694,   -1,
+  354, 3367,  520,   -1,  608, 1656,   -1,   -1,   -1,   -1, 4451, 1376, 2648, 2526, 3372, 1439,
+   -1,  984,  690, 4243,  265, 1191, 4506, 3888, 3746, 1102,   -1,   -1,   -1, 2169, 2479,   -1,
+   -1, 3883, 2410, 1461,   -1, 3021, 1739,   -1, 4229,   -1,  496,   -1, 1724,   -1, 2117, 4277,
+  582,  837, 1125,  558, 1785, 2119,   -1,   -1, 4509, 3056, 3795, 2878, 4526, 4201,  316, 4465,
+   39, 3962, 1308, 3055, 2060,   -1,  406, 4310, 3350, 4834,   -1, 2437,   -1, 3580, 2937,   -1,
+   -1,   -1, 2262,   -1,   -1, 1780,   -1, 3543, 2655,   -1, 2333, 1521,   -1, 3310, 3582,   -1,
+ 1571, 1509, 2382, 4663, 4366,   -1,   -1, 1323, 2326, 3112, 3661, 4569, 4180, 2236, 2680,   -1,
+ 3594, 2847,   -1, 3917, 4370,  844, 1113,   -1,  968, 1383, 4600, 3511,   -1, 1245, 4337, 2070,
+   -1,   -1,   -1, 1850,  697, 2394,   -1, 1933,   -1, 3784,   -1,  997, 2115, 1636, 3648,   -1,
+ 3317, 3517, 1458,   -1, 1602, 3565, 1940, 4712, 1057,   -1, 3057,   -1, 2750, 4376,   -1, 4523,
+ 3279,   -1,   -1, 2405, 1400, 1129, 2524, 2697, 3345, 3825, 2296, 3944,   -1,   -1, 2257,   -1,
+  472,   -1, 1586, 2941, 2000,   -1,   -1,   -1, 2684,   -1, 2157, 4802,   -1, 1952,   -1, 2634,
+ 2265, 3519, 2603, 3723, 2991,   -1,   -1,   -1,   -1,  748, 1951,  138, 1266,   -1,  689, 1097,
+   -1,   -1, 2585, 1755,   -1,   -1,   -1, 2353,  533, 1194, 3024, 3889, 4578, 3403, 4452,   -1,
+   -1, 3060, 3653, 1568, 2898,   -1,  140,   -1, 1390, 1733, 3445, 3830,  225, 1445, 3846, 4838,
+   -1,  581, 1215,   -1,   -1,   -1, 2247,  419,   -1,  477, 3442,  121, 1802,   -1,   -1,  817,
+   -1,   -1,   -1,   -1, 3766,   -1,  613, 1232,  239,   -1,   -1, 4143,   -1, 3876, 2836, 3132,
+ 4368,   -1,  953,   -1,   -1, 2210, 4677,   -1,   -1,   -1,   -1, 1866, 3498, 1126,   -1,  899,
+ 2766,   -1,   -1, 2865,   -1,  819, 2756,   -1, 2917,   33,   -1, 2584, 3357, 1883,   -1,  900,
+ 1856, 1898,   -1, 3284,   -1,   -1, 1448,   -1,   -1, 3915,   -1,   -1,  556,   -1,   -1,   -1,
+ 2694,   -1,   -1, 2034,   -1,   -1,   -1,   -1,   -1, 4728,   -1,   -1,   -1,   -1, 1399,  754,
+   -1,   -1, 1971, 1263, 3268,   31,   -1, 2407,   -1,   -1,  269,   -1,   -1,  730,  590, 1553,
+   -1,   -1, 4796,   -1, 3827,   -1,   -1,   -1,  220, 2559, 1460, 2753,  967,   -1,   -1, 1532,
+   -1,   -1,   -1,   -1, 2429,   -1, 1801,  287, 2875,   -1, 3526, 4064,   -1,  559, 3180,  663,
+ 3308,   -1, 1988, 3053,   -1,   -1, 2495, 3697,   -1, 3189, 1980,   10,  157,   -1,   -1, 4708,
+   -1, 4615,   -1,   -1,   -1, 1316, 3704,   -1,   -1,   -1,   -1, 3389, 2554, 3938, 3410,   -1,
+ 1360, 3422,  332,  673,   -1,  560, 3951,   -1, 2425, 4161, 3794, 2874, 2059, 4742, 1170,  870,
+ 1887,   -1,   -1,  110, 2528,  182,   -1, 3277,   -1,   -1, 3682, 2359, 2090,   -1,  115,   -1,
+ 4113, 1637, 2249, 4786,   -1,   -1,   -1,   -1, 2391, 2153, 3547, 1559,   -1,   -1,   -1,   -1,
+   63, 4538, 1995, 3707,   -1, 1105, 2861,   94,   -1, 3484,  334, 4826, 3078, 3163, 2842,   -1,
+ 4194,   -1,   -1, 2019, 2481,   -1,  103,   -1,   -1, 1210,  944, 1834,   -1,   -1, 4755,  222,
+   -1,   -1,   11, 4338, 2591, 2439,  578,  714, 3524,   -1, 1634, 1557, 1718,   -1,   -1,   -1,
+ 4260, 4757,   -1,   -1, 1662,   -1, 1340,  244, 2361, 2212, 3199, 2108,   -1,   -1,   -1,   -1,
+   -1, 1767,   -1,   -1,   -1,   -1,   -1, 2264,   -1,   -1, 1925, 2452,   -1,   -1, 2143,  254,
+ 2921,   -1,   -1,  874,   -1, 1456,   -1, 3904, 3619,   -1, 4215, 3194,   -1,  468, 1794,   -1,
+ 1692,   -1,   -1,   -1, 3487,  300,   -1, 3371, 4177,   -1,   -1,   -1,   -1,   -1, 4371,   -1,
+   -1,   -1, 1938, 1203, 1654,   -1,   -1, 4100, 3075, 2190, 2734,   84,  135,   -1, 2502,   -1,
+  315, 2969, 4288,   -1,   -1,   -1, 2373,   -1,   -1, 1248,   -1,  954, 1729,   -1, 2295,   -1,
+ 1384,   -1,   -1, 3408,   -1,   -1,   -1,   -1,  856, 1065,   -1,   -1, 1970,   -1,   -1,   -1,
+   -1,   -1,   -1, 2195, 4283, 2857, 3607, 4546, 1331,   -1,  479,  474,  378, 2008, 2984, 1888,
+ 3441, 2608,   -1, 3286, 2556, 3686,   -1,  242, 4210,   -1, 4022,   -1,   -1, 3450,   61, 1871,
+ 4418,   -1, 2327, 4502,   -1,   -1,   -1,   -1,   -1,  832,   -1,   -1, 1120,   -1, 4434, 4202,
+ 2272, 4484, 4837, 1823, 2788, 1683, 2960,   -1,   -1, 3791, 4139,   -1, 2493, 4568,   -1, 1710,
+  591,   -1, 1851,   -1, 4261,  268, 2062, 2523, 1513, 3643, 1607, 3318,   -1, 2689, 1762, 3574,
+ 2510, 1905,   -1,   -1,  653,   -1, 2832,  825, 1318,   -1, 4027, 2304, 3549,  250,   27,   -1,
+   -1,   -1,  109,  933,   -1, 4501,   -1, 2069, 1914,   -1, 2925, 4024, 2899,   -1, 1072,   -1,
+   -1,   -1,   -1,   -1, 1465,   -1,  327,   -1,   -1, 3768,   -1,  737, 2682,   -1,   -1,   -1,
+   -1, 2188,   -1,   -1,   -1, 3082, 4689,   -1,   -1,   -1,   -1, 4382,   -1,  198,   -1, 4652,
+  361,   -1,   -1,   -1, 3968, 3650,  906, 3174, 1516, 3412,   -1, 1196,   -1,   -1,   -1, 4584,
+  502,  851, 1597, 3416,   -1, 2519,  992, 2930, 2812,   -1, 1093,   -1,   -1, 2952,  546,   -1,
+ 4467,   -1, 3598, 3996, 4116, 3100, 3554,  424,   -1, 2723,   -1, 3050, 2534, 3479,   -1,   -1,
+   -1,  672, 2580, 1947, 4721,   -1,   -1, 3797, 1864,   -1,   -1, 4499,   -1,   -1, 2335,   -1,
+  384, 4268, 3106, 3922, 4450, 4602,  956,   -1,   19, 3093,   -1,   -1,   38,   -1, 1645,   -1,
+   -1,   -1, 1961,  858, 2134,   -1, 3758, 3405,   -1,   -1,   -1,  973,  605,   -1,  767, 1540,
+ 4530,   -1, 2046,  917,   -1,   -1,   -1, 1275,   -1, 3013,   -1, 4486,   -1, 2271,  701,   -1,
+ 2163,   -1,   -1,   -1, 4346, 4514, 3133,   -1, 3856,  195,   -1, 2478, 2844,  397,   -1,   -1,
+   -1, 2023, 2797,   -1,   -1,   -1,   -1, 3667, 4142,  307,   -1,  151,  715,   -1, 4482,   -1,
+ 1870, 2911,   -1,   -1,   -1,   85,   -1, 4381, 4347, 4244, 4145,   -1,   -1, 4294, 4110, 2849,
+   -1,   -1, 4018, 2940,  137,  878,   -1, 3303,   -1, 2058,   -1,   -1, 3918,  683, 4684, 2987,
+  996,   -1,   -1, 3296, 1254, 1522,   -1,   -1,   -1,  746,  785,   -1,   -1, 1081,   -1,   -1,
+   -1, 3496,   -1,   -1, 2356,   -1, 3090,  803, 1891, 3457,   -1, 1955, 1776,   -1, 4766,   -1,
+ 1598,  535,   -1, 4536,   -1,  804, 2950,  893, 1777, 2032,   -1,   -1,   -1,   -1,   -1, 4130,
+ 3376, 1846,   62,   -1,   -1,   -1, 4625, 3739, 1747, 4306,  235, 3860, 2268,   -1,  391,  489,
+   -1,   -1, 3157,   -1,   -1, 3288, 1879, 4469,   -1, 1306, 1695,   -1, 1534,   -1,  431, 2752,
+   17, 3227, 2644, 2771, 3426,   -1,  838, 3014, 4350,   -1, 2601,   -1, 4045, 3981,  712,  565,
+ 4679,  633, 1709,   -1,   -1,   -1,  700, 1770,   -1, 2717,   -1, 1545, 1707,   -1, 3781, 1681,
+ 2107, 2015, 1467,   -1,  128, 4498, 4644,   -1,   -1, 1038, 1807,   -1,   -1, 3592, 3935, 4150,
+ 1622,  707, 3755,   -1, 1375,   -1,   -1,   -1, 1903,   -1,   -1, 1214,   -1, 3750, 2467,   -1,
+ 3419,  480,  541,   -1,  202, 2672, 3032,   91, 3491, 2607, 3771,   -1, 3169,   -1, 4574, 2913,
+ 1252,   -1,   -1,   -1, 3004, 3373,   -1, 4060, 3300, 2829, 4787,   -1, 3624, 3934, 1524,   -1,
+ 1855, 1748,   -1,   -1,    8,   -1, 4827,   -1, 1226, 1890, 1321, 1902,   -1,   -1,   -1, 2627,
+   -1, 2447,   -1,  549,   -1, 3579, 2113, 2014, 1720,   -1, 1599,   -1, 2293,   -1,   -1, 3617,
+ 4190,   -1, 2142, 3823, 3796,   -1, 1151,   -1, 4011, 3378, 1314,   -1, 3722,   -1, 3134,   -1,
+  616, 3097, 2438, 3699,   -1, 3811,  330, 2455, 1626,   -1, 3301, 2558, 2027, 4385,   82,   -1,
+ 4134, 4032,  445,   -1, 2971, 4729,   -1,   -1,   -1,   -1,   -1, 3655,   -1, 2533,   -1, 3814,
+   -1,   -1,   -1, 2758, 3950,   -1, 3033,   -1, 4697, 2442, 4441,   -1,   -1, 3851,  247, 2227,
+ 3229,   -1, 2881, 1675,   -1,   -1, 4348, 1832, 2005,  272,  429, 2769,   -1, 1274,   -1, 4264,
+   -1,   55,   -1,   -1, 2457,  928,   80,   -1, 2255,  861, 4001,  776,   -1,   -1, 4446, 1889,
+   -1, 1543, 2434,  629,   -1,   -1, 3734,   -1, 4262, 3182,  237, 1672, 3984, 4327, 1185, 4449,
+   -1, 3087, 1987,   -1,   -1, 4775,  758, 4534, 3280,   -1,   -1, 1084,   -1,   -1,   -1, 2402,
+   -1, 3745, 1051,  910,   18,   -1,   -1,   -1, 1162,   -1,   -1,  759, 3735,  328, 3095, 3845,
+ 4249, 4203,   -1, 3390,   -1, 3455,   48,   -1,  706, 1575,   -1, 1784,   -1, 1002,   -1,   -1,
+ 1978, 3872, 3831,   -1,   78,   -1, 1965,   -1,   -1,  205, 2234,   -1, 1819, 3440,   -1, 4648,
+ 1539,   -1, 1354, 2172,   -1,   -1,   -1,   -1,   -1, 1095, 2814,   -1,   -1,   -1,   -1, 2598,
+ 2095,  393,   -1, 4280, 2628, 4219,  456, 2736, 4326,   -1,   -1,   -1, 4297, 1858, 1118,   -1,
+ 3966, 4764, 4308,  721,   -1,   -1, 4258,   -1, 2131, 2340,   -1,   -1, 3398,   -1,   -1,   -1,
+ 1373, 2537,  160,  836,   -1, 4320,  351,  224,   -1,  676, 3291, 1073, 2768, 3709,  624, 1168,
+ 2935,   -1,   -1,   -1,   -1, 3936, 1504,   20, 4789, 3905, 3507,   -1, 4587, 2568, 4089, 1292,
+   -1,   -1, 2828,  136,  521,   -1,   -1, 2174,   -1, 3882,   -1, 1627, 2491, 2198, 4259,   59,
+   -1, 3848,  873, 2130,  320,   -1,  273, 1618, 2727, 3269,   -1,   -1, 1047, 2114, 3773, 2275,
+   -1,   -1,   -1, 1110, 1638, 3439,   69,   -1,   -1, 2532,   -1,   -1,   -1, 4030, 3146, 4364,
+   -1, 3520,  150, 4349, 1878, 2516, 1552, 1211,  206,   -1,   -1, 3278, 3948, 2499,   -1,  400,
+ 2618, 2011, 2989, 1749,  801,   -1,  228, 3384,   -1, 3869, 3612, 1518, 2345,   -1,   -1,   -1,
+ 2305, 1455, 3611,  850,  216,   -1, 3072,   -1, 3589,  430, 2557, 1737, 3887, 4192, 2703, 2856,
+ 4561, 2897, 2933,   -1, 2176, 3155, 2722,   -1, 1775, 1293,   -1, 1493,   -1,   -1,   -1,   -1,
+  517,   90,   -1,   -1, 3392,   67, 4395,  833, 3540, 3995,   -1, 1297, 2741,  389,   -1,   -1,
+   -1,   -1, 1231,   -1, 2349,   -1,   -1, 2956, 1779,  363,   -1,   -1, 3048,  822,   -1, 3679,
+ 4627, 3837,   -1,   -1,   -1,   -1,  427, 3150,   -1,   -1,   -1,   -1,   -1,  120, 3370,   -1,
+   -1,   25,   -1,   -1,   -1,   -1,   -1, 4050,   -1, 1117, 2288,   -1, 4454, 4129,   -1,  548,
+   -1, 1059,   -1, 2731, 4558, 4433,   -1,   -1, 2302, 2170, 4236, 3726,   -1,   -1, 4036,   -1,
+   -1,   -1, 2624, 2744, 3826, 3610, 3929,   -1,   -1,   -1,   -1,   -1,   -1, 1674, 1393,   -1,
+ 1028, 3385, 4426, 3930,  914, 1843,   -1, 3642, 3179, 2885,   -1,   -1,   -1, 1310, 3315, 2129,
+ 3821,   83,   -1,   -1, 3040,   -1,   -1,  751,   -1,  347,  774, 2823, 2988,   -1,  818, 3807,
+ 2699,   -1,   56,   -1,   -1, 2995,   -1,  622,   -1,   -1, 3553,  305,   -1,   -1, 3353, 2216,
+   -1,   -1, 3858,   -1, 2577,   -1, 2017, 2737,   -1,   -1, 3207,   -1, 3137, 2675,   -1, 3031,
+ 2399, 1791,   -1,   -1, 4435,   -1, 2636, 3402, 1617,   -1,   -1, 3401, 4819,   -1, 1083, 3678,
+   16, 3933,   -1,  277, 1155, 2714,  286,   -1,   -1,   -1,   -1, 1732, 3829,   -1,   -1, 1927,
+ 3018,   -1,   -1, 3759, 4220,   -1, 2146, 3557,   -1,   -1,   -1, 3141, 3541,   -1,   -1,   -1,
+ 3757, 3546, 4396, 2449,  985, 2918, 3664,   -1,   -1,   -1,  974, 2370,  604,   -1, 1359, 3976,
+   -1,  163,   -1,   -1, 3454, 1171, 1246,   -1,   -1, 2440,   -1, 1993,   -1,   -1, 3669, 2698,
+ 2661,   -1, 2239, 4570, 4781, 4711,   -1, 3448,   -1, 2498,   -1,   -1, 2962, 1091,   37,   -1,
+  296,  223, 4301,   -1, 4628,   -1, 2337,   -1, 1957, 1416, 2652,   -1, 4790,  631,   -1,  359,
+ 1972, 2846,  729,   -1,   -1, 3756,   -1, 3366,  829,   -1,   -1,  459, 2891,   -1,   -1,   -1,
+  897, 2800, 3228,   -1,   -1, 4646,   -1,   -1, 3432,  756,   -1, 4541,   -1, 1412,   -1, 1485,
+ 1530,   -1,   -1,   -1, 2825, 1276,   -1, 2784, 3769,   -1, 4803,   -1, 1505, 4273, 2629,   -1,
+ 3518,   -1,   -1, 4019,  263,  866, 2051,  916,   -1,   -1,  142,   -1,   -1, 1262,   -1,   -1,
+ 1449,   -1, 1736,   -1,  169, 4375,   -1, 2599, 2613,   -1,   -1,  141,   -1, 3099,   -1, 2536,
+   -1,  446, 1495, 1436,   -1, 4738, 2222,   -1, 2999,   -1, 1301,   -1,  684,   -1,   -1,   -1,
+ 4401, 1659,   -1,   -1,   -1,   -1, 4759,   -1,   -1, 4624,  366,   -1, 1217, 4573,  551,   -1,
+  600,   -1, 4505, 1595, 3805,  979,   -1,   -1,   -1,  377,   -1,  341, 2513,  350, 4092,   -1,
+   -1,  626,   -1, 1820,   -1,   -1, 3621,   -1, 1815,   -1, 2456, 4688, 1507,   -1, 2473,   -1,
+ 4187, 1818, 1537, 3271,  312, 3608, 4821, 4589,   -1, 4788, 1738,   -1, 2330,   -1, 4520, 3223,
+ 1307,   -1,   -1, 1781, 1241, 4099,   -1, 1213,   -1, 4717,   -1, 1371, 4429, 4603, 2226, 2052,
+ 4025,   -1, 1332, 4295, 4052,   -1, 1139,   -1, 2406, 3017, 1087,   -1, 3037, 2140, 3689,   -1,
+ 1137,   -1,   -1, 1901,   -1, 4164, 4599,   -1, 1061, 1238,   -1,   -1, 4586, 3462, 1178, 3953,
+ 3702,   -1,   -1,   -1, 2912,   -1, 3767,  293,   -1,   -1, 4137, 2461,   -1, 2334,   -1, 3039,
+ 1916,   -1,   -1, 1803, 1580,   51, 3677,   -1,   -1, 2641, 2802, 4705, 1667,   -1,   -1,   -1,
+   -1,  215,   -1,   -1, 1023,  635,   -1, 1821,   -1, 2650,   -1, 4071,   -1, 3081, 2080, 2016,
+ 1874,   -1,  526, 1348,  574,   -1,   -1, 3641,   -1,  743, 3800, 1771,   -1, 2419,   -1,   -1,
+ 4427, 2542,   -1, 2492,   -1,   -1,   -1,   -1, 3209,  495, 3213, 1423,   -1,   -1,   -1,   -1,
+ 3388, 4068,  465, 3304,   -1, 1286,   -1,   -1, 4739,   -1, 1560, 2815, 2924,  153,  369,   -1,
+  210, 1510,   -1,   -1,  811,   -1,   -1, 3867, 2344, 4233,   -1, 3783,  940, 1774,   73, 3894,
+   -1, 4048, 2149, 1197,  852, 4034, 2282, 3413,   -1,   -1, 4281, 1593,   -1,   -1,   -1, 3434,
+  544,   -1,   -1,   -1, 2551,  537, 1218,   -1,  276,   -1,   -1,   -1, 1119,  441,  208, 4365,
+  988,   -1, 4458,   -1,   -1,  279, 2893, 4709,   -1,   -1, 1367,   -1, 4352, 1578, 4659,   -1,
+ 1290, 4165, 4196,   -1, 1577,   -1,   -1, 4483, 4318, 2593,  454,   -1, 3135, 3466,   -1,   -1,
+ 4528,   -1,   -1,  839,  599, 2009,   -1,   -1, 1899,   -1,  555, 1893,   -1,   -1,   -1, 3162,
+ 4023,   -1,   -1, 1548, 2390,   -1,   -1, 1278, 4315,   -1, 3200,   -1, 4658, 3675, 1336, 1764,
+ 2431,   -1,   -1, 4479,   -1,  805, 1403, 3776, 2997,   -1,   -1, 1050, 1447,   -1, 2033, 1527,
+ 2740, 2061, 3220,   -1, 2029, 4598,   -1,   -1,   -1, 4152, 3328, 1584, 3728, 1605, 1281,   -1,
+   -1,   -1,   -1,   -1, 4810, 2877, 3600, 4340, 2281,   -1,  410,   -1, 2575,   -1,   -1,  139,
+   -1,   -1,  573, 1799,   -1,   -1, 4224,   -1,   -1,   -1,   -1,   -1, 1481,   -1,   92, 4770,
+ 3979,   -1, 2204,   -1,   -1,   -1,  869, 2316,   -1,   -1,   -1,   -1, 2588, 3999,   -1, 1969,
+ 2824,  403, 2552,   -1,   -1,   -1,   -1, 2855,   -1, 1257, 3551,   -1,   -1,   -1,   -1,   -1,
+ 2145,   -1,   -1, 4733,   -1,   -1,  678, 3028, 2821, 4748,   -1,  726, 1019, 4159, 1661,  585,
+   -1,   -1,   -1, 1173, 1975,   -1,   -1, 2579, 2538, 2996,   -1, 1104,   -1,   86,   -1, 1004,
+ 4437, 1406, 1418, 1482, 3477,  753,   -1, 2329, 2667, 4563,   -1,   -1,   -1,   -1, 3556,   -1,
+   -1,   -1, 4061, 2979,  909, 3215, 4749, 4121, 4321,   -1, 2725, 3352, 2521,  174, 4485, 3201,
+   -1,  190,   -1,   -1, 3464,   -1, 1797,   -1, 4313, 4154,  894,   -1,   -1,   -1,   60, 4776,
+   -1, 3615,  598, 1711,  213,  217, 3051, 1609,   -1,  755, 3672,   -1,   -1,   -1, 2827,   -1,
+ 1744, 3476, 1096, 4183,   -1,   -1, 1677,  750,  612,  473, 3694, 3226,   -1,   -1,   -1, 3538,
+   -1, 2757,   -1,   -1,   -1,   -1, 4608,   -1,   -1,   -1,   -1, 1303,   -1, 3364, 3211,   -1,
+ 3844, 3701,   -1,   -1, 1003,   -1,   -1,   -1, 3601, 4477, 3919, 4017, 2696, 3437, 4231, 1949,
+   -1, 2073,   -1, 1653,   -1, 4213, 3691,   -1, 3238,   -1,   -1,   96,   -1,   -1,  925,   -1,
+ 4801, 1401, 2838,  602,   -1,  771,  830,   -1,   -1, 3899, 2809,  439,   -1, 3282,   -1,   -1,
+ 2795,   -1, 4610, 1526,  846, 3430, 4330,  720,   -1, 2357, 3334,   -1, 2876,   -1,   -1,   -1,
+ 2789,   -1, 2517,   -1,  234, 2896,   -1,   -1,  888,   -1, 4588,   -1, 1350, 1592, 1494,   -1,
+   -1,   44,   -1, 4082, 3799,   -1,   -1, 1158, 3144,   -1, 4519,   -1, 2808,   -1, 3096, 3276,
+ 2480, 1795,   -1,  995, 3630,   -1, 1754,   -1, 3914,  325,   -1,  348,   -1,  434, 2205, 2040,
+ 2785,   -1,  696, 2366, 1941,   -1,   -1, 2685,   -1,   -1, 1783, 2121,   -1,   -1,   -1,   -1,
+   -1,   -1, 2851,   -1, 3064,   -1, 2091, 3942, 4138,   -1,   -1,   -1,   -1,   -1, 4621,  650,
+ 2127, 2363, 4102, 4020, 4079,  632, 3191,   -1, 2194,   -1,   -1,   -1, 1924, 3647,   -1, 4247,
+   -1,   -1,   -1, 4002,   -1,   -1,   -1,   -1,  107,  383,   -1, 2459,   -1,   -1, 1796,  709,
+ 4108, 3368,   -1,   -1,   -1, 3294,  660, 2487, 4014, 2383,   -1,  271,   -1,   -1,   -1,   -1,
+ 4706, 3139, 3421, 1489,  860, 1459,   -1, 1150, 4257, 2573,   -1,   -1,   -1, 1032,   -1,   -1,
+   -1,  245, 4754,   -1, 1808, 3292, 1830,  619,   -1, 3480,   -1, 4460,   -1,  922,   -1, 2884,
+   -1,  584,   -1, 4147,   -1, 2549, 1533, 2681,  634,   -1, 1001, 4374, 3599,   -1, 3537,  485,
+ 3399, 2125,   -1, 4319,   -1, 3488,   -1, 4021,   -1,    4,   -1,   -1,   -1,   -1, 1763,   -1,
+ 1434, 2092, 1752, 3923,   -1, 3386, 3443,   -1,  379,   -1,   -1,   -1, 1620,  252, 1623,   -1,
+   -1,  927, 3597, 2087,  820, 3514,   -1, 2104,   -1, 3460,  314,   -1, 3605, 2691, 1163, 1319,
+ 4785,   -1,   -1, 1798, 4186, 3720,   -1, 3606, 4414,  122,  842, 2122, 1392,   -1,  835, 2966,
+ 1848, 2863, 2252,   -1,   -1, 4665, 3840,   -1,   -1,   -1,   -1,  798, 3662,   -1, 3094, 1702,
+ 4551, 4412, 3083,   -1,   -1, 2569,   -1,   -1, 2961,   -1, 2318, 1862, 3956,   -1,   -1,   -1,
+   -1,  810, 3061, 3508, 1759,   -1, 4265,   -1, 1714, 2500, 1619,   -1, 2175,  231, 1027, 2733,
+   -1,   -1, 3765,   -1, 2323, 3125,  298,   -1, 1172,   98, 2862,   -1,   -1, 1782,   -1, 2482,
+ 1773, 1508, 4115,  966, 2148,  791,   -1,   -1,  357,   -1, 1358, 4148, 4762,   -1,  503,  484,
+  209, 2905, 1146, 4296,  504,   -1, 2901, 1356, 1361, 4285,   -1,  627,   -1, 3504,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   49, 3949,   -1, 4630,   -1,  964, 3921, 4823,   -1,   -1,
+   -1,   -1,   -1,   -1,  736,   -1,   -1,   -1,   -1, 3190,   -1,   -1, 4378,   -1, 4357,   -1,
+ 2464,   -1,  386, 4174, 3319, 3252,   -1,  415, 2845, 3424,  593, 3806,   -1, 1673,   -1,  571,
+   -1, 1041, 4428,   -1,   -1, 1413,   -1, 4545,  518,   -1,   -1, 3798, 1391, 3418,   -1, 2525,
+   -1, 1937, 4671,   -1,  651,  108,   -1, 1480, 2720,   -1,   -1, 1453,   -1, 1600, 1690,   -1,
+ 4096,   -1, 4841, 1046, 4227,   -1,   -1,  950, 3993,  911,   -1, 2472,   -1,   -1,   -1, 3528,
+   -1, 1195, 3710, 1939,   -1,  229,  467,  483, 2043,   -1, 1698,   -1,   -1, 2422,   -1, 2156,
+   -1,   64,   -1, 4323,  499,   -1, 4720, 4400,  742,   -1, 3375,   -1, 3880,  392, 2605, 3505,
+   -1, 3724,   -1, 2494,   -1, 1291,   -1, 3210,   -1, 1080,  826, 1077, 3140, 3584,  345,  387,
+ 4535,   -1,  346,   -1,   -1,   -1,   14,   -1,  158, 3438, 3931,   -1, 1108, 4508, 2633, 4540,
+ 1768, 3391, 2454,   -1,   -1, 1396,   -1,  306,   -1, 4660, 1630,  889, 2729, 2872,   70, 1746,
+ 4783, 3339, 1208,   -1, 4491,   -1,   -1, 3287, 4070, 2854,   -1, 3705,   -1, 1205, 2632,  875,
+   -1, 1225,   -1, 4144,   -1, 2197,   -1,   -1, 1309, 1567,  807,   74,   -1, 1998, 3008, 3349,
+   -1, 2915, 1867,   -1,   -1, 1756,   -1, 1387, 2071,   -1,   -1, 3974,   -1, 4214,   -1,   -1,
+ 4473,   -1,   75,  853,  958,   -1, 2246,   -1, 3012,   -1, 2270, 2645, 3742,   -1,   -1,   -1,
+   -1, 1342, 2508, 4559,   -1, 3129, 2367, 4415, 3706, 2233, 2834, 4579,   -1,   -1,   -1,   -1,
+  106, 3855,   -1, 2763, 4181, 1535,   -1, 3747,   -1,  607, 3369,   -1,   -1, 4524,   -1,   -1,
+ 1379,  945,   -1,   -1,  214, 1906, 3485,   -1,   -1,   -1,   -1,   -1,   -1, 4818, 4276,   -1,
+ 1726,   -1,   -1, 4597,   -1,   -1,   -1,  957,   -1,   -1,   -1,   -1, 2830, 4241, 1347,   -1,
+   -1, 3147,   -1,  628, 4197, 1833, 1639,   -1, 1116,  185,   -1, 2048, 2791,  152,   -1, 1415,
+   -1,   -1,   -1,   -1,   88,   -1,   -1,   -1,   -1, 3566,   -1,   -1,  246,   -1,   -1, 4657,
+   -1,   -1, 4641,   -1,   -1, 4507, 2665,  147,   -1, 1574, 3737,   -1,   -1,  960, 1145,   -1,
+ 4091, 3688, 3590, 4592, 1325,  221,  175,   -1, 2841,   -1, 2783, 1025, 1048, 2679,   -1, 3788,
+   -1,  929, 4289, 2907,  374,   -1, 3627, 1996,  703, 2576,  176,  895, 4417, 3946, 1722, 2360,
+ 4432, 2180, 3003,   -1, 3270, 3049,   -1,   -1, 3657, 1100, 1652,   -1,   -1,   -1, 2007, 4422,
+ 2083,   -1,   -1,   -1, 4521,   -1, 4044,   -1,  207, 2319,  789,  708,   -1,   -1,   26,   -1,
+  982, 1483, 4453,  162,  991,   -1,  274,  849,   -1,  670,   -1,   -1,  102, 1302, 3065, 3459,
+   -1,   -1,   -1,   -1,   -1,  867, 4436,   -1, 1816, 4361,   -1,  577,   -1,  280,   -1,   -1,
+ 1341, 1086, 3379,   -1,   -1,   -1,   -1,   -1,   47,   -1, 1227,   -1,  717, 1441,  716, 1457,
+   -1,   -1, 3471,   -1,   -1, 2244,   -1, 2686, 3108, 3344, 3062,   -1,  704, 1520, 2414, 1923,
+ 4304, 3898, 1666, 1854, 2869, 2761,  101, 3585, 4548, 4666, 4298,  662, 2496, 2654, 4831,   -1,
+ 3748, 4619, 4471, 3591,   -1, 2561,   -1, 4489, 3324, 3420, 4643, 4752, 3809, 1056, 1734,   -1,
+   -1,   -1,   -1,   -1, 3743, 3509, 3987,  146, 2078, 1289,  519, 2609,   -1,   -1, 2411,   -1,
+ 4620,   -1,   -1,   -1,   -1,   -1,   -1, 1536,   -1, 3534, 2965, 3486,   -1,   -1, 2840, 4157,
+   -1,   -1,  134, 4140, 3716,   -1,   -1,   -1,   -1,   -1,  405, 2306,   -1, 2173, 1610,   -1,
+   -1,   -1,   -1, 3947,   -1,   -1,  923, 2408, 3217, 1631, 4184, 3461,   -1,  335,   -1,  620,
+ 3036, 4325, 3853,   -1, 3231,   -1,   -1,   -1,   -1, 4504,   -1,  884,   -1, 2274, 2317,   -1,
+   -1,   -1, 3552,   -1, 2509,   -1, 2384,   -1,   -1, 4424, 2660,   -1,   -1,   99, 4699,   -1,
+   -1, 3911,   -1,   -1, 2587,   -1, 4179,   -1, 3363, 3326,   -1,   -1, 3010,   -1,   -1,  385,
+ 4542,   -1, 4322,  920,   -1,  414, 2793,   -1,   -1, 1328, 4682, 4637, 3197, 2158,   -1,  880,
+ 1101, 1443, 4510,    2, 3681, 2775, 4389,  309, 2651,   -1, 1366,   -1,   -1,  343, 4690,   -1,
+   -1,   -1,   -1, 1033, 1466,   -1, 1426, 4216, 2241,   -1, 2181,   -1,   -1,  508, 4168, 2614,
+ 1935,  891,   -1, 2150,    0,  290,   -1,   -1, 1287, 2076,   -1, 3120,   -1,   -1,   -1, 3690,
+  299,   -1,   -1,   -1, 3803, 4189, 3875,   -1,   -1,  173, 4639, 3536,   -1,   -1,   -1,   -1,
+   -1, 3729, 1363, 2578, 1422,  890,   -1, 3272,   -1, 2630,   -1, 4373, 1166,   -1, 1123,   -1,
+   -1, 3988,   -1, 4088,   -1,  794,   -1,  130, 3067, 2139,   -1,   -1, 4405, 3131, 4557, 1742,
+ 2451, 3983, 2178, 1658,   -1, 1817,  566,  550,  961, 3503, 4053,   -1, 1757, 2276,   -1, 3957,
+   -1,   -1,   -1,   -1, 4270, 4675, 1529,  912,   -1,   -1, 1036,   -1,   -1,   -1,   -1,  980,
+   -1, 3264, 3861,   -1, 1407,   -1,   -1, 2662,   -1, 2343,   -1,   -1, 1596, 2501,   -1,   -1,
+   -1,   -1, 1977, 1076, 1569, 1285,   -1, 3568,   -1,   -1,   -1, 1786, 4607, 1766, 1555, 1800,
+   -1, 3813, 3832, 1587,   -1, 2811,  901, 1984, 3620,  597, 4367,   -1,   -1, 1335, 4205,   -1,
+ 3652,   -1,   -1, 3240,   -1, 3263,   -1, 2260,  823,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1, 1334, 2732,   -1,   -1,   -1, 2471,   57, 4674, 1405,  942,   -1, 2505,  482, 2401, 1839,
+ 3820, 3221, 4777,   -1, 1298,   -1, 2690,   -1,   -1,   -1, 3658,   -1, 2522, 4616,   -1,  469,
+ 1247,  311, 1917,   -1,  323, 4362, 3103,   -1, 4695, 3337, 2985, 2710, 4175, 1514, 1098, 3009,
+ 1474,   -1,  877,   -1, 4444, 1058, 2678,   -1, 4532, 4016, 4560,   -1,   -1, 2705,   -1,   -1,
+   -1,   -1,   36,   -1, 1564,   -1,   -1, 2799,  575, 1008,   -1,   -1, 2168, 3649,   -1, 2504,
+  275,   -1, 3493,  289, 1300,   -1, 3864,   -1, 2695, 2582,  292,   -1,   -1,   -1,  913,   -1,
+  691,   -1,   95, 4693, 1472, 4745, 4556,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+ 2352,  505, 2225, 3550, 2314,   -1,   -1, 1687,   -1,   -1, 2765,  333, 4515, 1106,   -1, 2485,
+ 2709, 4246,  876,   -1,   -1,  105, 2539, 1926,   -1,   -1,   -1, 3411,   -1,   -1, 3121,   -1,
+ 1174, 1948,  727,   -1, 2350,   -1,   -1,   -1,   -1, 1414, 4332, 4552,   -1,   -1, 2942, 2135,
+ 2445, 4767, 1579, 1523, 4513, 2688, 4571, 3602,   -1, 1811,   -1,   -1, 1920, 2245,  614, 4768,
+  133, 2980,   -1,   -1,   -1, 2315,   -1, 2572,   81,   -1,   -1, 4580,  232,   -1,   -1,  285,
+   -1, 2308,   -1,   -1,   -1,   -1,   -1,   -1, 2324, 3042,   -1, 2118,   -1, 3500, 2657,   -1,
+ 1052, 3857, 1169, 1136,   -1,   -1,   -1,   -1,  127, 3625,   -1, 1882,  376,   -1,   -1,   -1,
+   -1, 3027, 2964, 3431, 3684,   -1, 2904, 1792, 4555, 1484,   -1,   -1,   -1, 3089,   -1,   -1,
+ 3266,   -1,  524, 3752,  116, 4004,   -1,   -1, 1589, 4423,   -1,   -1,   -1, 1556,  388,  547,
+   -1, 1296,  367, 1997,   -1, 2297, 3879,   -1,   -1,  493,   -1,   -1, 3573,  824, 4765,   -1,
+ 3893, 1153,   -1, 1345,  606, 4388,   -1, 1133, 2959, 3184, 1981,   -1, 3982,   -1, 1183, 2967,
+   -1, 2570,   -1,   -1,   -1, 2649,   -1, 4771, 4160,   -1,   -1,   -1,   -1,   -1, 4686,   -1,
+   -1,  443,   -1, 3354,   -1,   -1, 3676,  919,  770, 4676,   -1,   -1,   -1,   -1,   -1,   -1,
+  199, 4593,   -1,   -1, 4772, 1968, 2668,   -1, 2162, 4035, 2475,   -1,   -1, 3114, 3895, 1477,
+   -1,   -1, 2774,   -1,   -1, 3975, 2760,   -1,   -1,   -1, 1377,   -1, 3530,  699,   -1, 2590,
+ 4416,   -1,   -1, 1352,   -1, 2787, 1450, 3952, 2248, 1778,   43, 3839,  887, 2916,  336,  375,
+ 2065, 1295, 4488,   -1,  358, 3029,  281,   -1,   -1,   -1, 3312, 2364,   -1,   -1, 2474,   -1,
+  255,  329,   -1, 3816,   -1,   -1,  428, 2047, 1946, 3142, 3356,  183,  677, 2850, 2615, 4549,
+   -1,   -1,  266,   -1, 1601, 2594,   -1, 3117, 3586,   -1,   30, 1212,  219,  733, 4118,   45,
+  779,   -1,  946, 4494, 2221,   -1,   -1, 1156,  337,   -1, 2555,   -1,   -1,   -1,   -1,  786,
+ 4500,   -1,   -1, 1531,  248, 2416, 3091, 2581,  123, 1728,   -1,   -1,  523, 4564, 4611, 2643,
+ 4815,   -1,   -1,   -1,   -1,  769,   -1,   -1, 4278,   -1,   -1,   -1, 3819,  647, 1273, 2110,
+   -1, 4779,   -1,   -1, 1486, 2939,  679, 1603,   -1, 4112,   -1,  463,  522, 1370,   -1, 3074,
+   -1, 2299, 3085,   -1,   -1,  738, 1549, 1454, 4170,   -1, 3577,   -1, 3377, 1024,  178, 3774,
+ 2365, 3634,   -1, 2348, 1499,  360,  576, 3325,   -1, 3026, 3532,   -1,   -1, 3558, 3665, 1043,
+   -1,  871,   -1,  765,   -1, 3637,   -1,   -1, 4824,   -1,  510, 2300,   -1, 1558, 3639, 2024,
+ 3854, 1686,   -1, 4651,   -1, 1237,  372,   -1, 1487, 2943,  831,   -1,   -1, 4343,   -1,   -1,
+  641,   -1, 4049, 1322,    3,   -1,   -1,   -1, 2807, 2626,   93,  417,   -1,   -1,  990,   -1,
+   -1, 1475, 2229, 2597,  301, 1442,   -1, 1694, 4255,   -1,   -1, 4594,   -1, 3329, 1712, 2936,
+   -1,   -1,   -1, 2332, 1204,   -1, 4791, 3492, 4275,   -1, 3666,   -1, 3101, 4784, 1143,   -1,
+   -1, 4287, 2331, 4577,   -1,   -1,   -1,   -1, 2369, 3824,   -1, 1452,   -1,   -1, 3321,   -1,
+  494,   -1,   -1, 3046,   -1, 3708,   -1, 1427,  747,   -1,   -1, 1202, 4609, 1528,   -1,   -1,
+ 1192,   -1, 2395,   -1,   -1,   -1,  401,   -1, 2387,   -1, 2141,   -1, 1750, 2166, 1875,   -1,
+ 3444,  562,   -1,   -1,   -1,  240,   -1,   -1, 1841, 4253,   -1,   -1,   -1, 4407, 4063, 2116,
+   -1, 3779, 1283, 3274, 2541, 2096,   -1,  962, 3576, 2088, 3015,  124, 2039, 2888, 3633, 3559,
+ 2792, 1394, 4390,   -1,   -1, 4193, 2386,   -1, 3499, 4443,   -1, 3513,   -1, 4811,   -1,   -1,
+   -1,   -1, 4758,   -1, 3260,   -1,   -1, 4191,   -1,   -1,   -1,   -1,   -1, 1857, 2215, 3311,
+   -1, 2279, 3107, 2948,   -1,   -1, 1716, 4041,   -1, 1132, 3208,  356, 1124, 2381,   -1,  262,
+   -1,   -1,   -1,   -1, 2666, 3295, 2773, 2611,   -1,   -1,   -1, 3043,   -1, 1054,   -1,   -1,
+ 1258, 3943, 3792,   -1, 2055,   -1,   -1,   -1, 3076,   -1, 3436, 2004,   -1,   -1, 2957,   -1,
+ 2535, 3991,  475,   -1,  693,   -1, 3084,  949,   -1, 4807, 4042,   -1, 1114, 3474,   77,   -1,
+   -1,   -1,  680,   -1, 3998, 4459,   -1,   -1,  172, 2754,   -1, 4605,   -1,   -1,   -1,   -1,
+ 1983,   -1,   -1,   -1, 1629,   -1,   -1, 3427, 1317,   -1,  171,   -1, 2606,   -1,   -1,   -1,
+   -1,  251, 3852, 4335, 2638, 3285, 3616, 4640, 1929, 4167, 3167,   -1, 3148, 2656, 1725,   -1,
+ 4038, 4037, 3400, 1324, 4166,  364, 2583,   -1,   -1,   -1, 2712,  253, 4531, 4792,  540,   -1,
+ 2433, 2619, 2687,   -1,  787,   -1,   -1,  188, 2128, 4406,   -1, 1138, 1496,   -1,   -1, 1910,
+  506,   -1,   -1, 2676, 3907,   -1, 3038,   -1,   -1, 4232,   -1, 4369,   -1,   -1,   -1, 4266
+};
     
 static const char* uid_registry[] = {
 /*    0 */ "1.2.840.10008.1.1", "Verification SOP Class", "SOP Class",
@@ -10,6 +10,7 @@
 #include <sstream>
 #include <type_traits>
 
+#include "arena.h"
 #include "dicom.h"
 #include "instream.h"
 #include "util.h"
@@ -153,14 +154,19 @@ void DataElement::_fromNumberVectorToAttrTags(const std::vector<AVT> &value) {
 
 DataElement::DataElement(tag_t tag, vr_t vr, size_t length, size_t offset,
                          DataSet *parent)
-    : tag_(tag), vr_(vr), length_(length), offset_(offset), parent_(parent) {
+    : tag_(tag),
+      vr_(vr),
+      arena_value_(false),
+      length_(length),
+      offset_(offset),
+      parent_(parent) {
   // DataElement should be constructed by DataSet::addDataElement
   // assert parent != nullptr
   if (vr_ == VR::SQ) {
-    seq_ = new Sequence(parent_);
+    seq_ = parent_->arena()->create<Sequence>(parent_);
   } else if (vr_ == VR::PIXSEQ) {
     tsuid_t tsuid = parent->getTransferSyntax();
-    pixseq_ = new PixelSequence(parent_, tsuid);
+    pixseq_ = parent_->arena()->create<PixelSequence>(parent_, tsuid);
   } else {
     ptr_ = nullptr;
   }
@@ -174,11 +180,11 @@ DataElement::DataElement(tag_t tag, vr_t vr, size_t length, size_t offset,
 DataElement::~DataElement() {
   if (ptr_) {
     switch (vr_) {
-      case VR::SQ:
-        delete seq_;
+      case VR::SQ:  // memory is released with the Arena
+        seq_->~Sequence();
         break;
       case VR::PIXSEQ:
-        delete pixseq_;
+        pixseq_->~PixelSequence();
         break;
       default:
         _free_ptr();
@@ -550,11 +556,14 @@ Buffer<T> DataElement::toBuffer() {
     else {
       Buffer<T> buf(length_ / sizeof(T));
       if (sizeof(T) == 2)
-        copyswap2((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
+        copyswap2((uint8_t *)buf.data, (uint8_t *)value_ptr(),
+                  buf.size * sizeof(T));
       else if (sizeof(T) == 4)
-        copyswap4((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
+        copyswap4((uint8_t *)buf.data, (uint8_t *)value_ptr(),
+                  buf.size * sizeof(T));
       else if (sizeof(T) == 8)
-        copyswap8((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
+        copyswap8((uint8_t *)buf.data, (uint8_t *)value_ptr(),
+                  buf.size * sizeof(T));
       return buf;
     }
   }
@@ -1379,7 +1388,12 @@ void DataElement::alloc_ptr_(size_t size) {
 
   _free_ptr();
   if (size == 0) return;
-  ptr_ = ::malloc(size);
+  if (size <= DATAELEMENT_ARENA_VALUE_LENGTH && parent_) {
+    ptr_ = parent_->arena()->allocate(size);
+    arena_value_ = true;
+  } else {
+    ptr_ = ::malloc(size);
+  }
   if (!ptr_) {
     LOGERROR_AND_THROW(
         "DataElement::alloc_(size_t) - "
@@ -1391,7 +1405,10 @@ void DataElement::alloc_ptr_(size_t size) {
 
 void DataElement::_free_ptr() {
   if (ptr_) {
-    ::free(ptr_);
+    if (arena_value_)
+      arena_value_ = false;  // memory is released with the Arena
+    else
+      ::free(ptr_);
     ptr_ = nullptr;
     length_ = 0;
   }
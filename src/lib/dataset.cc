@@ -10,6 +10,21 @@
 #include <string.h>
 #include <wchar.h>
 
+#ifdef _WIN32
+#include <io.h>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef ERROR  // conflicts with LogLevel::ERROR
+#else
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -18,14 +33,21 @@
 #include <string>
 #include <vector>
 
+#include "arena.h"
 #include "deflate.h"
 #include "dicom.h"
 #include "instream.h"
+#include "itemscan.h"
+#include "outstream.h"
+#include "threadpool.h"
+#include "util.h"
 
 namespace dicom {
 
 DataSet::DataSet()
     : root_dataset_(this),
+      arena_owner_(new Arena()),
+      arena_(arena_owner_.get()),
       transfer_syntax_(UID::EXPLICIT_VR_LITTLE_ENDIAN),
       specific_charset0_(CHARSET::UNKNOWN) {
   // 0xffffffff for last_tag_loaded_ will prevent getDataElement try to load()
@@ -37,6 +59,7 @@ DataSet::DataSet()
 
 DataSet::DataSet(DataSet* parent)
     : root_dataset_(parent),
+      arena_(parent->arena()),
       transfer_syntax_(parent->getTransferSyntax())
 {
   last_tag_loaded_ = 0x0;
@@ -49,7 +72,8 @@ DataSet::~DataSet() { LOG_DEBUG("-- @%p\t~DataSet::~DataSet()", this); }
 
 void DataSet::close() {
   edict_.clear();
-  detach();  
+  detach();
+  if (arena_owner_) arena_owner_->reset();
 }
 
 DataElement* DataSet::addDataElement(tag_t tag, vr_t vr, uint32_t length,
@@ -63,10 +87,27 @@ DataElement* DataSet::addDataElement(tag_t tag, vr_t vr, uint32_t length,
           TAG::repr(tag).c_str());
     }
   }
-  removeDataElement(tag);
-  return (edict_[tag] = std::unique_ptr<DataElement>(
-              new DataElement(tag, vr, length, offset, this)))
-      .get();
+  arena_ptr<DataElement> de(
+      arena_->create<DataElement>(tag, vr, length, offset, this));
+  DataElement* ptr = de.get();
+
+  if (edict_.empty() || edict_.back().first < tag) {
+    // tags come in ascending order while loading a file.
+    edict_.emplace_back(tag, std::move(de));
+  } else {
+    auto it = _lower_bound(tag);
+    if (it != edict_.end() && it->first == tag)
+      it->second = std::move(de);  // replace existing one
+    else
+      edict_.emplace(it, tag, std::move(de));
+  }
+  return ptr;
+}
+
+DataSet::element_table_t::iterator DataSet::_lower_bound(tag_t tag) {
+  return std::lower_bound(
+      edict_.begin(), edict_.end(), tag,
+      [](const element_table_t::value_type& e, tag_t t) { return e.first < t; });
 }
 
 DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
@@ -178,7 +219,7 @@ DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
 
       while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
         n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
+      tag = TAG::from_keyword(_tagstr, n);
       if (tag == 0xffffffff)
         LOGERROR_AND_THROW(
             "DataSet::getDataElement - error in string '%s'; no such keyword "
@@ -232,147 +273,34 @@ DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
 
 DataElement* DataSet::getDataElement(tag_t tag)
 {
-  if (this == root_dataset_ && tag > last_tag_loaded_) load(tag, NULL);
+  if (this == root_dataset_ &&
+      last_tag_loaded_.load(std::memory_order_acquire) != 0xffffffff) {
+    // another thread may be loading more elements into `edict_`.
+    std::lock_guard<std::recursive_mutex> lock(load_mutex_);
+    if (tag > last_tag_loaded_) load(tag, NULL);
+
+    auto it = _lower_bound(tag);
+    if (it != edict_.end() && it->first == tag)
+      return it->second.get();
+    else
+      return DataElement::NullElement();
+  }
 
-  auto it = edict_.find(tag);
-  if (it != edict_.end())
+  auto it = _lower_bound(tag);
+  if (it != edict_.end() && it->first == tag)
     return it->second.get();
   else
     return DataElement::NullElement();
 }
 
 DataElement* DataSet::getDataElement(const char *tagstr) {
-  char *_tagstr = (char *) tagstr;
-  char *nextptr;
-  char *endptr = (char *) tagstr + strlen(tagstr);
-
-  tag_t tag, gggg, eeee;
-  tag_t block;
-  int seqidx;
-  DataElement *el;
-  DataSet* dataset = this;
-
-  while (1) {
-    // ignore starting (
-    if (_tagstr[0] == '(')
-      _tagstr++;
-
-    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
-        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
-         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
-      // string starts with number - read gggg or ggggeeee
-      tag = tag_t(strtol(_tagstr, &nextptr, 16));
-
-      if (nextptr && (*nextptr == ',' || *nextptr == '{')) {
-        // if string->hex conversion is stopped by ',' or '{',
-        // first portion is group number
-        gggg = tag;
-
-        // if ",{" string sequence, skip ','
-        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
-
-        // string between { and } is creator id
-        // e.g. 0000,{CREATOR}00
-        if ((*nextptr == '{') && (tag & 1)) {
-          _tagstr = nextptr + 1;
-
-          nextptr++;
-          int n = 0;
-          while (nextptr[n] && nextptr[n] != '}') n++;
-
-          if (nextptr[n] == '\0') {
-            LOGERROR_AND_THROW(
-                "DataSet::getDataElement(\"%s\"): "
-                "malformed string -- no matching '}'",
-                tagstr);
-            el = DataElement::NullElement();
-            break;
-          }
-          std::string creator(nextptr, n);
-
-          // find element from gggg0001 to gggg00ff
-          for (block = 0x10; block <= 0xff; block++) {
-            DataElement* creator_de =
-                dataset->getDataElement(TAG::build(gggg, block));
-            if (!creator_de->isValid()) continue;
-            if (creator_de->toBytes() == creator) break;
-          }
-
-          if (block > 0xff) {
-            // no such block of elements from private creator
-            el = DataElement::NullElement();
-            break;
-          }
-
-          _tagstr = nextptr + n + 1;
-
-          // Get element number in the block
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-          eeee = (block << 8) + (eeee & 0xff);
-        } else {
-          _tagstr = nextptr + 1;
-
-          // Get element number in eeee form
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-        }
-
-        if (eeee == 0 && _tagstr == nextptr)
-          LOGERROR_AND_THROW(
-              "DataSet::getDataElement - "
-              "malformed string '%s'; no number after ',' or '}'",
-              tagstr);
-
-        tag = TAG::build(gggg, eeee);
-
-        if (*nextptr == ')') nextptr++;
-      }
-    } else {
-      // tagstr is keyword string
-      int n = 0;
-
-      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
-        n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
-      if (tag == 0xffffffff)
-        LOGERROR_AND_THROW(
-            "DataSet::getDataElement - error in string '%s'; no such keyword "
-            "'%s'",
-            tagstr, std::string(_tagstr, n).c_str());
-
-      nextptr = (char *) _tagstr + n;
-    }
-
-    _tagstr = nextptr + 1;
-
-    el = dataset->getDataElement(tag);
-    if (!el->isValid())
-      break;
-
-    if (_tagstr >= endptr)
-      break;
-
-    if (el->vr() != VR::SQ)
-      LOGERROR_AND_THROW(
-          "DataSet::getDataElement - error in string '%s'; VR of element %s "
-          "(VR::%s) is not VR::SQ",
-          tagstr, TAG::repr(tag).c_str(), VR::repr(el->vr()));
-
-    // number after '.' is DataSet sequence number, starting from 0
-    seqidx = int(strtol(_tagstr, &nextptr, 10));
-
-    dataset = el->toSequence()->getDataSet(seqidx);
-
-    _tagstr = nextptr + 1;
-    if (dataset == NULL || _tagstr >= endptr) {
-      // no DataSet with index in the Sequence
-      el = DataElement::NullElement();
-      break;
-    }
-  }
-  return el;
+  return TagPath(tagstr).find(this);
 }
 
-void DataSet::removeDataElement(tag_t tag) { edict_.erase(tag); }
+void DataSet::removeDataElement(tag_t tag) {
+  auto it = _lower_bound(tag);
+  if (it != edict_.end() && it->first == tag) edict_.erase(it);
+}
 
 void DataSet::removeDataElement(const char *tagstr) {
   char *_tagstr = (char *) tagstr;
@@ -465,7 +393,7 @@ void DataSet::removeDataElement(const char *tagstr) {
 
       while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
         n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
+      tag = TAG::from_keyword(_tagstr, n);
       if (tag == 0xffffffff)
         LOGERROR_AND_THROW(
             "DataSet::removeDataElement - error in string '%s'; no such keyword "
@@ -509,42 +437,51 @@ void DataSet::removeDataElement(const char *tagstr) {
 
 charset_t DataSet::getSpecificCharset(int index) {
   if (this != root_dataset_)
-    return root_dataset_->getSpecificCharset();
-
-  if (specific_charset0_ == CHARSET::UNKNOWN) {
-    DataElement* de = root_dataset_->getDataElement(0x00080005);
-
-    if (de->isValid()) {
-      char* valueptr = (char*)de->value_ptr();
-      size_t valuesize = de->length();
-
-      char* firstdelim = strchr(valueptr, '\\');
-      if (firstdelim == NULL) {
-        // no delim, only one character set
-        specific_charset1_ = specific_charset0_ =
-            CHARSET::from_string(valueptr, valuesize);
+    return root_dataset_->getSpecificCharset(index);
+
+  charset_t charset0 = specific_charset0_.load(std::memory_order_acquire);
+  if (charset0 == CHARSET::UNKNOWN) {
+    // several threads may ask for the charset of a DataSet at the same time.
+    std::lock_guard<std::recursive_mutex> lock(load_mutex_);
+    charset0 = specific_charset0_.load(std::memory_order_relaxed);
+    if (charset0 == CHARSET::UNKNOWN) {
+      charset_t charset1;
+      DataElement* de = getDataElement(0x00080005);
+
+      if (de->isValid()) {
+        char* valueptr = (char*)de->value_ptr();
+        size_t valuesize = de->length();
+
+        char* firstdelim = (char*)memchr(valueptr, '\\', valuesize);
+        if (firstdelim == NULL) {
+          // no delim, only one character set
+          charset1 = charset0 = CHARSET::from_string(valueptr, valuesize);
+        } else {
+          const char* lastdelim = firstdelim;
+          for (const char* p = firstdelim; p < valueptr + valuesize; p++)
+            if (*p == '\\') lastdelim = p;
+          charset0 = CHARSET::from_string(valueptr, firstdelim - valueptr);
+          charset1 = CHARSET::from_string(
+              lastdelim + 1, valuesize - (lastdelim + 1 - valueptr));
+        }
       } else {
-        const char* lastdelim = strrchr(valueptr, '\\');
-        specific_charset0_ =
-            CHARSET::from_string(valueptr, firstdelim - valueptr);
-        specific_charset1_ = CHARSET::from_string(
-            lastdelim + 1, valuesize - (lastdelim + 1 - valueptr));
+        charset0 = charset1 = CHARSET::DEFAULT;
+      }
+
+      if (charset0 == CHARSET::UNKNOWN || charset1 == CHARSET::UNKNOWN) {
+        LOG_WARN("   DataSet::specific_charset - unknown CHARSET \"%s\"",
+                 std::string((char*)de->value_ptr(), de->length()).c_str());
+        charset0 = charset1 = CHARSET::DEFAULT;
       }
-    } else {
-      specific_charset0_ = specific_charset1_ = CHARSET::DEFAULT;
-    }
 
-    if (specific_charset0_ == CHARSET::UNKNOWN ||
-        specific_charset1_ == CHARSET::UNKNOWN) {
-      LOG_WARN("   DataSet::specific_charset - unknown CHARSET \"%s\"",
-               std::string((char*)de->value_ptr(), de->length()).c_str());
-      specific_charset0_ = CHARSET::DEFAULT;
-      specific_charset1_ = CHARSET::DEFAULT;
+      // publish `specific_charset1_` with `specific_charset0_`.
+      specific_charset1_ = charset1;
+      specific_charset0_.store(charset0, std::memory_order_release);
     }
   }
 
   if (index == 0)
-    return specific_charset0_;
+    return charset0;
   else
     return specific_charset1_;
 }
@@ -606,7 +543,7 @@ void DataSet::attachToMemory(const uint8_t* data, size_t datasize,
   iss->attachmemory(data, datasize, copy_data);
 }
 
-void DataSet::attachToFile(const char* filename) {
+void DataSet::attachToFile(const char* filename, bool use_mmap) {
   // only a root DataSet may have InStream
   if (this != root_dataset_) {
     LOGERROR_AND_THROW(
@@ -614,6 +551,13 @@ void DataSet::attachToFile(const char* filename) {
   }
   detach();
 
+  if (use_mmap) {
+    is_ = std::unique_ptr<InStream>(new InMmapStream);
+    InMmapStream* ims = dynamic_cast<InMmapStream*>(is_.get());
+    ims->attachfile(filename);
+    return;
+  }
+
   is_ = std::unique_ptr<InStream>(new InFileStream);
   InFileStream* ifs = dynamic_cast<InFileStream*>(is_.get());
   ifs->attachfile(filename);
@@ -623,6 +567,155 @@ void DataSet::attachToInstream(InStream* basestream, size_t size) {
   is_ = std::unique_ptr<InStream>(new InSubStream(basestream, size));
 }
 
+// Read VR and value length of a data element whose tag, VR and length are in
+// `buf8`. Reads 4 more bytes from `instream` for VRs with 4 bytes length.
+static vr_t _read_vr_length(InStream *instream, uint8_t *buf8, tag_t tag,
+                            bool is_explicit_vr, bool is_little_endian,
+                            size_t &length) {
+  uint8_t buf4[4];
+  size_t n;
+  vr_t vr;
+
+  // DATA ELEMENT STRUCTURE WITH EXPLICIT VR
+  if (is_explicit_vr) {
+    vr = VR::from_uint16le(uint16_t(buf8[4])+uint16_t(buf8[5])*256);
+    length = load_e<uint16_t>(buf8 + 6, is_little_endian);
+
+    switch (vr) {
+      case VR::FL:
+      case VR::FD:
+      case VR::SL:
+      case VR::UL:
+      case VR::SS:
+      case VR::US:
+
+      case VR::AE:
+      case VR::AS:
+      case VR::AT:
+      case VR::CS:
+      case VR::DA:
+      case VR::DS:
+      case VR::DT:
+      case VR::IS:
+      case VR::LO:
+      case VR::LT:
+      case VR::PN:
+      case VR::SH:
+      case VR::ST:
+      case VR::TM:
+      case VR::UI:
+        // PS 3.5-2020, Table 7.1-2
+        // Data Element with Explicit VR of AE, AS, AT, CS, DA, DS, DT, FL,
+        // FD, IS, LO, LT, PN, SH, SL, SS, ST, TM, UI, UL and US
+        break;
+
+      case VR::OB:
+      case VR::OD:
+      case VR::OF:
+      case VR::OL:
+      case VR::OV:
+      case VR::OW:
+      case VR::SQ:
+      case VR::UN:
+
+      case VR::SV:
+      case VR::UC:
+      case VR::UR:
+      case VR::UV:
+        // PS3.5-2020, Table 7.1-1. Data Element with Explicit VR other than
+        // as shown in Table 7.1-2
+        // OB, OD, OF, OL, OV, OW, SQ and UN
+        // VRs of SV, UC, UR, UV and UT may not have an Undefined Length
+
+        n = instream->read(buf4, 4);
+        if (n < 4)
+          LOGERROR_AND_THROW(
+              "DataSet::load - cannot read 4 bytes for data element value's "
+              "length at {%x}",
+              instream->tell());
+        length = load_e<uint32_t>(buf4, is_little_endian);
+        break;
+
+      case VR::UT:
+        // In a strange implementation, VR 'UT' takes 2 bytes for 'len'
+        n = instream->read(buf4, 4);
+        if (n < 4)
+          LOGERROR_AND_THROW(
+              "DataSet::load - cannot read 4 bytes for data element value's "
+              "length at {%x}",
+              instream->tell());
+        length = load_e<uint32_t>(buf4, is_little_endian);
+        if (length > instream->bytes_remaining()) {
+          instream->unread(4);
+          length = load_e<uint16_t>(buf8 + 6, is_little_endian);
+        }
+        break;
+
+      default:
+        // salvage codes some unusual VR
+        // A non-standard VR 'UK' in RAYPAX file; may contains a short string
+        // and have 2 byte length
+        if (buf8[4] == 'U' && buf8[5] == 'K') {
+          vr = VR::UN;
+        } else {
+          // assume this Data Element has implicit vr
+          // PS 3.5-2009, Table 7.1-3
+          // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
+          length = load_le<uint32_t>(buf8 + 4);
+
+          vr = TAG::get_vr(tag);
+          if (vr == VR::NONE) vr = VR::UN;
+        }
+        break;
+    }
+  } else {
+    // PS 3.5-2009, Table 7.1-3
+    // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
+
+    // always little endian if vr is implicit.
+    length = load_le<uint32_t>(buf8 + 4);
+
+    vr = TAG::get_vr(tag);
+    if (vr == VR::NONE) vr = VR::UN;
+  }
+  return vr;
+}
+
+// Move `instream` over a sequence whose value starts at the current position
+// and let `seq` parse its items on first access. A sequence with undefined
+// length is scanned for the end of its items. Returns the length of the value.
+static size_t _defer_sequence(Sequence *seq, InStream *instream, size_t length,
+                              bool is_explicit_vr, bool is_little_endian) {
+  size_t offset = instream->tell();
+
+  if (length == 0xffffffff) {
+    instream->seek(
+        find_items_end(instream, offset, is_explicit_vr, is_little_endian));
+    length = instream->tell() - offset;
+  } else {
+    if (length > instream->bytes_remaining())
+      length = instream->bytes_remaining();
+    instream->skip(length);
+  }
+
+  seq->setDeferredLoad(instream->rootstream(), offset, length);
+  return length;
+}
+
+void DataSet::setLoadTags(const std::vector<tag_t>& tags) {
+  load_tags_ = tags;
+  std::sort(load_tags_.begin(), load_tags_.end());
+  load_tags_.erase(std::unique(load_tags_.begin(), load_tags_.end()),
+                   load_tags_.end());
+}
+
+bool DataSet::_is_tag_to_load(tag_t tag) const {
+  // elements needed to read other elements.
+  if (TAG::group(tag) == 0x0002 || tag == 0x00080005 || tag == 0x00280100)
+    return true;
+  return std::binary_search(load_tags_.begin(), load_tags_.end(), tag);
+}
+
 // - First call from DataSet::loadDicomFile()
 //   tag_t can be any value and instream should be valid
 // - Second and further calls from DataSet::loadDicomFile()
@@ -631,7 +724,6 @@ void DataSet::attachToInstream(InStream* basestream, size_t size) {
 // - Call from Sequence::load()
 //   tag_t should be (ffff,ffff) and instream should be valid.
 void DataSet::load(tag_t load_until, InStream *instream) {
-  uint8_t buf4[4];
   size_t n;
 
   tag_t gggg, eeee, tag;
@@ -725,126 +817,35 @@ void DataSet::load(tag_t load_until, InStream *instream) {
       break;
     }
 
-    // DATA ELEMENT STRUCTURE WITH EXPLICIT VR
-    if (is_explicit_vr) {
-      vr = VR::from_uint16le(uint16_t(buf8_[4])+uint16_t(buf8_[5])*256);
-      length = load_e<uint16_t>(buf8_ + 6, is_little_endian);
-
-      switch (vr) {
-        case VR::FL:
-        case VR::FD:
-        case VR::SL:
-        case VR::UL:
-        case VR::SS:
-        case VR::US:
-
-        case VR::AE:
-        case VR::AS:
-        case VR::AT:
-        case VR::CS:
-        case VR::DA:
-        case VR::DS:
-        case VR::DT:
-        case VR::IS:
-        case VR::LO:
-        case VR::LT:
-        case VR::PN:
-        case VR::SH:
-        case VR::ST:
-        case VR::TM:
-        case VR::UI:
-          // PS 3.5-2020, Table 7.1-2
-          // Data Element with Explicit VR of AE, AS, AT, CS, DA, DS, DT, FL,
-          // FD, IS, LO, LT, PN, SH, SL, SS, ST, TM, UI, UL and US
-          break;
+    vr = _read_vr_length(instream, buf8_, tag, is_explicit_vr,
+                         is_little_endian, length);
 
-        case VR::OB:
-        case VR::OD:
-        case VR::OF:
-        case VR::OL:
-        case VR::OV:
-        case VR::OW:
-        case VR::SQ:
-        case VR::UN:
-
-        case VR::SV:
-        case VR::UC:
-        case VR::UR:
-        case VR::UV:
-          // PS3.5-2020, Table 7.1-1. Data Element with Explicit VR other than
-          // as shown in Table 7.1-2
-          // OB, OD, OF, OL, OV, OW, SQ and UN
-          // VRs of SV, UC, UR, UV and UT may not have an Undefined Length
-
-          n = instream->read(buf4, 4);
-          if (n < 4)
-            LOGERROR_AND_THROW(
-                "DataSet::load - cannot read 4 bytes for data element value's "
-                "length at {%x}",
-                instream->tell());
-          length = load_e<uint32_t>(buf4, is_little_endian);
-          break;
-
-        case VR::UT:
-          // In a strange implementation, VR 'UT' takes 2 bytes for 'len'
-          n = instream->read(buf4, 4);
-          if (n < 4)
-            LOGERROR_AND_THROW(
-                "DataSet::load - cannot read 4 bytes for data element value's "
-                "length at {%x}",
-                instream->tell());
-          length = load_e<uint32_t>(buf4, is_little_endian);
-          if (length > instream->bytes_remaining()) {
-            instream->unread(4);
-            length = load_e<uint16_t>(buf8_ + 6, is_little_endian);
-          }
-          break;
-
-        default:
-          // salvage codes some unusual VR
-          // A non-standard VR 'UK' in RAYPAX file; may contains a short string
-          // and have 2 byte length
-          if (buf8_[4] == 'U' && buf8_[5] == 'K') {
-            vr = VR::UN;
-          } else {
-            // assume this Data Element has implicit vr
-            // PS 3.5-2009, Table 7.1-3
-            // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
-            length = load_le<uint32_t>(buf8_ + 4);
-
-            vr = TAG::get_vr(tag);
-            if (vr == VR::NONE) vr = VR::UN;
-          }
-          break;
-      }
-    } else {
-      // PS 3.5-2009, Table 7.1-3
-      // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
+    // Data Element's values position
+    offset = instream->tell();
 
-      // always little endian if vr is implicit.
-      length = load_le<uint32_t>(buf8_ + 4);
+    if (!load_tags_.empty() && this == root_dataset_ &&
+        !_is_tag_to_load(tag)) {
+      // skip a data element which is not in the tags to load.
+      if (length == 0xffffffff)
+        instream->seek(find_items_end(instream, offset, is_explicit_vr,
+                                      is_little_endian));
+      else if (instream->skip(length) != length)
+        LOGERROR_AND_THROW(
+            "DataSet::load - "
+            "cannot skip %lu bytes for tag=%08x, vr=%s from {%x}",
+            length, tag, VR::repr(vr), offset);
 
-      vr = TAG::get_vr(tag);
-      if (vr == VR::NONE) vr = VR::UN;
+      UINT32(buf8_) = 0;  // clear temporary buffer for tag, vr and length
+      last_tag_loaded_ = tag;
+      if (tag == load_until) break;
+      continue;
     }
 
-    // Data Element's values position
-    offset = instream->tell();
-
     if (vr == VR::SQ) {
-      if (length == 0xffffffff) length = instream->bytes_remaining();
-
       DataElement *de = addDataElement(tag, vr, length, offset);
-      Sequence *seq = de->toSequence();
-      InSubStream subs(instream, length);
-
-      size_t offset_end;
-      seq->load(&subs);
-      offset_end = subs.tell();
-      length = offset_end - offset;
+      length = _defer_sequence(de->toSequence(), instream, length,
+                               is_explicit_vr, is_little_endian);
       de->setLength(length);
-
-      instream->skip(length);
     }
 
     else if (tag == 0x7fe00010) {
@@ -856,7 +857,7 @@ void DataSet::load(tag_t load_until, InStream *instream) {
           LOGERROR_AND_THROW(
               "DataSet::load - "
               "cannot process %d bytes for tag %s, vr %s from {%08x}",
-              length, TAG::repr(tag).c_str(), (vr), offset);
+              length, TAG::repr(tag).c_str(), VR::repr(vr), offset);
         }
       }
 
@@ -894,6 +895,17 @@ void DataSet::load(tag_t load_until, InStream *instream) {
     else {
       if (length != 0xffffffff) {
         addDataElement(tag, vr, length, offset);
+
+        // read a short value together with the next tag, so the value is
+        // on the memory without another read from the file.
+        if (length <= INSTREAM_SHORT_VALUE_LENGTH &&
+            length <= instream->bytes_remaining()) {
+          size_t size = length + 8;
+          if (size > instream->bytes_remaining())
+            size = instream->bytes_remaining();
+          instream->get_pointer(offset, size);
+        }
+
         long n = instream->skip(length);
 
         // TODO: throw ///////////////
@@ -904,19 +916,11 @@ void DataSet::load(tag_t load_until, InStream *instream) {
               length, tag, VR::repr(vr), offset);
       } else {
         // PROBABLY SEQUENCE ELEMENT WITH IMPLICIT VR WITH ...
-        length = instream->bytes_remaining();
         vr = VR::SQ;
         DataElement *de = addDataElement(tag, vr, length, offset);
-        Sequence* seq = de->toSequence();
-        InSubStream subs(instream, length);
-
-        size_t offset_end;
-        seq->load(&subs);
-        offset_end = subs.tell();
-        length = offset_end - offset;
+        length = _defer_sequence(de->toSequence(), instream, length,
+                                 is_explicit_vr, is_little_endian);
         de->setLength(length);
-
-        instream->skip(length);
       }
     }
 
@@ -940,24 +944,173 @@ void DataSet::load(tag_t load_until, InStream *instream) {
   if (instream->is_eof()) last_tag_loaded_ = 0xFFFFFFFF;
 }
 
-void DataSet::saveToFile(const char* filename) {
+#ifdef _WIN32
+// return true if `h` is a HANDLE of the file which `is` reads bytes from.
+static bool _is_source_file(InStream* is, HANDLE h) {
+  HANDLE src = (is ? (HANDLE)is->rootstream()->source_file_handle() : NULL);
+  BY_HANDLE_FILE_INFORMATION srcinfo, info;
+  return src != NULL && h != INVALID_HANDLE_VALUE &&
+         GetFileInformationByHandle(src, &srcinfo) &&
+         GetFileInformationByHandle(h, &info) &&
+         srcinfo.dwVolumeSerialNumber == info.dwVolumeSerialNumber &&
+         srcinfo.nFileIndexHigh == info.nFileIndexHigh &&
+         srcinfo.nFileIndexLow == info.nFileIndexLow;
+}
+
+static bool _is_source_file(InStream* is, const char* filename) {
+  HANDLE h = CreateFileA(filename, 0,
+                         FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                         NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (h == INVALID_HANDLE_VALUE) return false;
+  bool same = _is_source_file(is, h);
+  CloseHandle(h);
+  return same;
+}
+
+static void _write_file(const OutStream& os, const char* filename) {
   std::ofstream ofs;
   ofs.open (filename, std::ofstream::out | std::ofstream::binary);
   if (!ofs) {
     char *errmsg = strerror(errno);
     LOGERROR_AND_THROW("cannot write to \"%s\": %s", filename, errmsg);
   }
-  saveToStream(ofs);
+  os.write_to(ofs);
   ofs.close();
+  if (!ofs)
+    LOGERROR_AND_THROW("cannot write to \"%s\"", filename);
+}
+
+// write `os` to a new file next to `filename` and move it to `filename`,
+// which `is` reads bytes from; bytes of the old file may be copied while
+// writing.
+static void _replace_file(const OutStream& os, const char* filename,
+                          InStream* is) {
+  std::string tmpname = std::string(filename) + ".XXXXXX";
+  if (_mktemp_s(&tmpname[0], tmpname.size() + 1) != 0)
+    LOGERROR_AND_THROW("cannot make a temporary file for \"%s\"", filename);
+  try {
+    _write_file(os, tmpname.c_str());
+  } catch (DicomException&) {
+    remove(tmpname.c_str());
+    throw;
+  }
+
+  // Windows doesn't replace a file while it is open. InFileStream reads the
+  // rest of the file into memory and closes it; a mapped file stays open and
+  // the move may fail, leaving the file as it was.
+  InFileStream* ifs = dynamic_cast<InFileStream*>(is->rootstream());
+  if (ifs && ifs->prefetch(0, ifs->filesize())) ifs->detachfile();
+
+  if (!MoveFileExA(tmpname.c_str(), filename, MOVEFILE_REPLACE_EXISTING)) {
+    unsigned long err = (unsigned long)GetLastError();
+    remove(tmpname.c_str());
+    LOGERROR_AND_THROW("cannot write to \"%s\": error code %lu", filename,
+                       err);
+  }
+}
+#else
+// return true if `st` is of the file which `is` reads bytes from.
+static bool _is_source_file(InStream* is, const struct stat& st) {
+  int srcfd = (is ? is->rootstream()->source_file_descriptor() : -1);
+  struct stat srcst;
+  return srcfd >= 0 && fstat(srcfd, &srcst) == 0 &&
+         srcst.st_dev == st.st_dev && srcst.st_ino == st.st_ino;
+}
+
+// write `os` to a new file next to `filename` and rename it to `filename`;
+// bytes of the old file may be copied while writing.
+static void _replace_file(const OutStream& os, const char* filename,
+                          mode_t mode) {
+  char* realname = realpath(filename, NULL);
+  std::string target(realname ? realname : filename);
+  free(realname);
+
+  std::string tmpname = target + ".XXXXXX";
+  int fd = mkstemp(&tmpname[0]);
+  if (fd < 0) {
+    char *errmsg = strerror(errno);
+    LOGERROR_AND_THROW("cannot write to \"%s\": %s", tmpname.c_str(), errmsg);
+  }
+  (void)fchmod(fd, mode & 07777);
+  try {
+    os.write_to(fd);
+  } catch (DicomException&) {
+    ::close(fd);
+    unlink(tmpname.c_str());
+    throw;
+  }
+  if (::close(fd) != 0 || rename(tmpname.c_str(), target.c_str()) != 0) {
+    char *errmsg = strerror(errno);
+    unlink(tmpname.c_str());
+    LOGERROR_AND_THROW("cannot write to \"%s\": %s", filename, errmsg);
+  }
+}
+#endif
+
+void DataSet::saveToFile(const char* filename) {
+  OutStream os;
+  _saveTo(os);
+
+#ifdef _WIN32
+  // `os` may hold ranges of the file this DataSet is read from, which
+  // truncating it would destroy before they are copied.
+  if (_is_source_file(is_.get(), filename)) {
+    _replace_file(os, filename, is_.get());
+    return;
+  }
+  _write_file(os, filename);
+#else
+  // `os` may hold ranges of the file this DataSet is read from, which
+  // O_TRUNC would destroy before they are copied.
+  struct stat st;
+  if (stat(filename, &st) == 0 && _is_source_file(is_.get(), st)) {
+    _replace_file(os, filename, st.st_mode);
+    return;
+  }
+
+  int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0) {
+    char *errmsg = strerror(errno);
+    LOGERROR_AND_THROW("cannot write to \"%s\": %s", filename, errmsg);
+  }
+  try {
+    os.write_to(fd);
+  } catch (DicomException&) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+#endif
+}
+
+void DataSet::saveToFd(int fd) {
+#ifdef _WIN32
+  if (_is_source_file(is_.get(), (HANDLE)_get_osfhandle(fd)))
+#else
+  struct stat st;
+  if (fstat(fd, &st) == 0 && _is_source_file(is_.get(), st))
+#endif
+    LOGERROR_AND_THROW(
+        "DataSet::saveToFd - cannot write to the file which the DataSet is "
+        "read from; use saveToFile()");
+  OutStream os;
+  _saveTo(os);
+  os.write_to(fd);
 }
 
 std::string DataSet::saveToMemory() {
-  std::ostringstream oss(std::ostringstream::binary);
-  saveToStream(oss);
-  return oss.str();
+  OutStream os;
+  _saveTo(os);
+  return os.str();
 }
 
 void DataSet::saveToStream(std::ostream& oss) {
+  OutStream os;
+  _saveTo(os);
+  os.write_to(oss);
+}
+
+void DataSet::_saveTo(OutStream& os) {
   // Load configuration
   bool sq_explicit_length =
       Config::get("SAVE_SQ_EXPLICIT_LENGTH", "TRUE")[0] == 'T';
@@ -969,12 +1122,14 @@ void DataSet::saveToStream(std::ostream& oss) {
   // implementations cannot read fragmented frames in the multiframe pixeldata.
   size_t fragment_size =
       (size_t)Config::getInteger("PIXEL_FRAGMENT_SIZE", 0xfffffffe);
+  int deflate_level = (int)Config::getInteger("DEFLATE_LEVEL", 6);
+  int deflate_threads = (int)Config::getInteger("DEFLATE_THREADS", 0);
 
   bool is_little_endian = true;
   bool is_explicit_vr = true;
 
   // for calculating group length, item value length, etc ...
-  std::vector<size_t> length_marker;
+  std::vector<OutStream::LengthMarker> length_marker;
 
   // start add metainfo --------------------------------------------------------
   // FileMetaInformationGroupLength
@@ -1002,23 +1157,22 @@ void DataSet::saveToStream(std::ostream& oss) {
   addDataElement(0x00020016, VR::AE)->fromBytes(DICOMSDL_SOURCEAETITLE);
   // end of add metainfo -------------------------------------------------------
 
+  // Data elements after the file meta information are deflated at the end
+  // for Deflated Explicit VR Little Endian.
+  bool deflated =
+      UID::from_uidvalue(getDataElement(0x00020010)->toBytes().c_str()) ==
+      UID::DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN;
+  size_t zipped_start = 0;  // offset of the first element to deflate
+
   // start lambda func for length calculation ----------------------------------
 
   std::function<void()> _pop_marker = [&]() {
-    size_t marker_pos = length_marker.back();
+    os.fill_length(length_marker.back(), is_little_endian);
     length_marker.pop_back();
-    size_t cur_pos = oss.tellp();
-
-    size_t length = cur_pos - marker_pos;
-    oss.seekp(marker_pos - 4);
-    char tmp[4];
-    store_e<uint32_t>(tmp, length, is_little_endian);
-    oss.write(tmp, 4);
-    oss.seekp(cur_pos);
   };
 
   std::function<void()> _push_marker = [&]() {
-    length_marker.push_back(oss.tellp());
+    length_marker.push_back(os.mark_length());
   };
 
   // start lambda func for saving ----------------------------------------------
@@ -1036,6 +1190,7 @@ void DataSet::saveToStream(std::ostream& oss) {
         writing_metainfo = false;
         is_little_endian = isLittleEndian();
         is_explicit_vr = isExplicitVr();
+        zipped_start = os.tell();
       } else if (!writing_metainfo && tag < 0x0002ffff) {
         // don't write metainfo
         continue;
@@ -1049,12 +1204,12 @@ void DataSet::saveToStream(std::ostream& oss) {
           // vr 2 bytes, 0000h
           *(uint16_t*)(buf16_ + 4) = *(uint16_t*)(VR::repr(vr));
           store_e<uint16_t>(buf16_ + 6, 0, is_little_endian);
-          oss.write((const char*)buf16_, 8);
+          os.write((const char*)buf16_, 8);
         }
 
         // length 4 bytes.
         store_e<uint32_t>(buf16_, 0xffffffff, is_little_endian);
-        oss.write((const char*)buf16_, 4);
+        os.write((const char*)buf16_, 4);
 
         if (sq_explicit_length) {
           // Table 7.5-1. Example of a Data Element with Implicit VR Defined as
@@ -1068,7 +1223,7 @@ void DataSet::saveToStream(std::ostream& oss) {
             store_e<uint16_t>(buf16_, 0xfffe, is_little_endian);
             store_e<uint16_t>(buf16_ + 2, 0xe000, is_little_endian);
             store_e<uint32_t>(buf16_ + 4, 0xffffffff, is_little_endian);
-            oss.write((const char*)buf16_, 8);
+            os.write((const char*)buf16_, 8);
 
             _push_marker();  // explicit byte length of DataSet item
             // Item Value DataSet
@@ -1089,7 +1244,7 @@ void DataSet::saveToStream(std::ostream& oss) {
             store_e<uint16_t>(buf16_, 0xfffe, is_little_endian);
             store_e<uint16_t>(buf16_ + 2, 0xe000, is_little_endian);
             store_e<uint32_t>(buf16_ + 4, 0xffffffff, is_little_endian);
-            oss.write((const char*)buf16_, 8);
+            os.write((const char*)buf16_, 8);
 
             // Item Value DataSet
             _saveToStream(seq->getDataSet(i));
@@ -1098,14 +1253,14 @@ void DataSet::saveToStream(std::ostream& oss) {
             store_e<uint16_t>(buf16_, 0xfffe, is_little_endian);
             store_e<uint16_t>(buf16_ + 2, 0xe00d, is_little_endian);
             store_e<uint32_t>(buf16_ + 4, 0xffffffff, is_little_endian);
-            oss.write((const char*)buf16_, 8);
+            os.write((const char*)buf16_, 8);
           }
 
           // Seq. delim. tag. (FFFE,E0DD), Item Length (0)
           store_e<uint16_t>(buf16_, 0xfffe, is_little_endian);
           store_e<uint16_t>(buf16_ + 2, 0xe0dd, is_little_endian);
           store_e<uint32_t>(buf16_ + 4, 0xffffffff, is_little_endian);
-          oss.write((const char*)buf16_, 8);
+          os.write((const char*)buf16_, 8);
         }
 
       } else if (vr == VR::PIXSEQ) {
@@ -1113,7 +1268,7 @@ void DataSet::saveToStream(std::ostream& oss) {
         *(uint16_t*)(buf16_ + 4) = *(uint16_t*)(VR::repr(VR::OB));  // 'OB'
         store_e<uint16_t>(buf16_ + 6, 0, is_little_endian);  // 0000H
         store_e<uint32_t>(buf16_ + 8, 0xFFFFFFFF, is_little_endian);
-        oss.write((const char*)buf16_, 12);
+        os.write((const char*)buf16_, 12);
 
         // check fragment_size loaded from configuration.
         if (fragment_size & 1)
@@ -1131,7 +1286,7 @@ void DataSet::saveToStream(std::ostream& oss) {
           store_e<uint16_t>(buf16_ + 2, 0xe000, is_little_endian);
           // Item Length 0000 0000H
           store_e<uint32_t>(buf16_ + 4, 0x00000000, is_little_endian);
-          oss.write((const char*)buf16_, 8);
+          os.write((const char*)buf16_, 8);
         } else {
           // Table A.4-2. Examples of Elements for an Encoded Two-Frame Image
           // Defined as a Sequence of Three Fragments with Basic Table Item
@@ -1142,12 +1297,12 @@ void DataSet::saveToStream(std::ostream& oss) {
           store_e<uint16_t>(buf16_ + 2, 0xe000, is_little_endian);
           // Item Length 4 * nframes
           store_e<uint32_t>(buf16_ + 4, nframes * 4, is_little_endian);
-          oss.write((const char*)buf16_, 8);
+          os.write((const char*)buf16_, 8);
 
           size_t offset = 0;
           for (int idx = 0; idx < pixseq->numberOfFrames(); idx++) {
             store_e<uint32_t>(buf16_, offset, is_little_endian);
-            oss.write((const char*)buf16_, 4);
+            os.write((const char*)buf16_, 4);
             size_t framesize = pixseq->encodedFrameDataSize(idx);
             size_t nfrags = framesize / fragment_size;
             if (nfrags * fragment_size < framesize) nfrags += 1;
@@ -1175,10 +1330,13 @@ void DataSet::saveToStream(std::ostream& oss) {
             store_e<uint16_t>(buf16_ + 2, 0xe000, is_little_endian);
             // Item Length
             store_e<uint32_t>(buf16_ + 4, bytestowrite, is_little_endian);
-            oss.write((const char*)buf16_, 8);
+            os.write((const char*)buf16_, 8);
 
             // write frame contents
-            oss.write(data, bytestowrite);
+            if (encdata.owndata)
+              os.write(data, bytestowrite);
+            else
+              os.write_ref(data, bytestowrite);
 
             data += bytestowrite;
             bytesremaining -= bytestowrite;            
@@ -1190,8 +1348,9 @@ void DataSet::saveToStream(std::ostream& oss) {
         store_e<uint16_t>(buf16_ + 2, 0xe0dd, is_little_endian);
         // Item Length 0000 0000H
         store_e<uint32_t>(buf16_ + 4, 0x00000000, is_little_endian);
-        oss.write((const char*)buf16_, 8);
+        os.write((const char*)buf16_, 8);
       } else {
+        size_t header_size;  // bytes of tag, VR and length in `buf16_`
         if (is_explicit_vr) {
           switch (vr) {
             case VR::FL:
@@ -1223,7 +1382,7 @@ void DataSet::saveToStream(std::ostream& oss) {
               // VR 2 bytes, length 2 bytes
               *(uint16_t*)(buf16_ + 4) = *(uint16_t*)(VR::repr(vr));
               store_e<uint16_t>(buf16_ + 6, de->length(), is_little_endian);
-              oss.write((const char*)buf16_, 8);
+              header_size = 8;
               break;
 
             case VR::OB:
@@ -1242,16 +1401,33 @@ void DataSet::saveToStream(std::ostream& oss) {
               *(uint16_t*)(buf16_ + 4) = *(uint16_t*)(VR::repr(vr));
               store_e<uint16_t>(buf16_ + 6, 0, is_little_endian);
               store_e<uint32_t>(buf16_ + 8, de->length(), is_little_endian);
-              oss.write((const char*)buf16_, 12);
+              header_size = 12;
               break;
           }
         } else {  // is_explicit_vr == false, is_little_endian should be true.
           // length 4 bytes
           store_le<uint32_t>(buf16_ + 4, de->length());
-          oss.write((const char*)buf16_, 8);
+          header_size = 8;
         }  // if (is_explicit_vr)
 
-        oss.write((char*)de->value_ptr(), de->length());
+        // An element whose value is still in the source stream, after the
+        // same header as it would be written, is copied from the source
+        // with its header. Runs of such elements are copied at once.
+        InStream* source =
+            (de->ptr_ == nullptr && ds->instream() ? ds->instream()->rootstream()
+                                                   : nullptr);
+        void* header = nullptr;
+        if (source && de->offset() >= header_size)
+          header =
+              source->get_pointer(de->offset() - header_size, header_size);
+
+        if (header && memcmp(header, buf16_, header_size) == 0) {
+          os.write_source(source, de->offset() - header_size,
+                          header_size + de->length());
+        } else {
+          os.write((const char*)buf16_, header_size);
+          os.write_ref(de->value_ptr(), de->length());
+        }
       }  // vr == VR::SQ or VR::PIXSEQ or VR::...
 
       // Calculate group length
@@ -1270,10 +1446,18 @@ void DataSet::saveToStream(std::ostream& oss) {
   if (writing_preamble && writing_metainfo) {
     uint16_t tmp[128];
     ::memset(tmp, 0, 128);
-    oss.write((char*)tmp, 128);
-    oss.write("DICM", 4);
+    os.write((char*)tmp, 128);
+    os.write("DICM", 4);
   }
+  if (!writing_metainfo) zipped_start = os.tell();
   _saveToStream(this);
+
+  if (deflated) {
+    OutStream zipped;
+    deflate_dicomfile(os, zipped, zipped_start, deflate_level,
+                      deflate_threads);
+    os.swap(zipped);
+  }
 }
 
 void DataSet::loadDicomFile(tag_t load_until){
@@ -1320,24 +1504,18 @@ void DataSet::loadDicomFile(tag_t load_until){
       DataElement* de = getDataElement(0x00020000);
       size_t zipped_start_offset = de->toLong() + de->offset() + de->length();
 
-      void* ptr =
-          is_->get_pointer(0, is_->end());  // pointer to whole DICOM file image
-      size_t zipped_len = is_->end();       // size of whole DICOM file image
-
-      // Inflated zipped data
-      std::ostringstream oss(std::ostringstream::binary);
-      inflate_dicomfile((uint8_t*)ptr, zipped_len, oss, zipped_start_offset);
+      // Inflate the rest of the file as it is parsed; offsets of elements
+      // in the file meta information are the same in the new stream.
+      std::unique_ptr<InInflateStream> iis(new InInflateStream);
+      iis->attach(std::move(is_), zipped_start_offset);
+      is_ = std::move(iis);
 
       LOG_DEBUG(
-          "   @%p\tDataSet::loadDicomFile(tag_t)  unzip deflated file %d -> %d",
-          this, zipped_len, is_->endoffset());
-
-      // AttachToMemory to new stream on memory
-      std::string inflated_image = oss.str();
-      attachToMemory((const uint8_t*)inflated_image.c_str(),
-                     inflated_image.size(), true);
+          "   @%p\tDataSet::loadDicomFile(tag_t)  inflate deflated file from "
+          "{%#x}",
+          this, zipped_start_offset);
 
-      // continue on new stream on memory
+      // continue on the inflated stream
       is_->seek(zipped_start_offset);
       UINT32(buf8_) = 0;  // clear temporary buffer for tag, vr, and length
     }
@@ -1353,10 +1531,30 @@ void DataSet::loadDicomFile(tag_t load_until){
 void DataSet::detach() { is_.reset(nullptr); }
 
 std::unique_ptr<DataSet> open_file(const char* filename, tag_t load_until,
-                                   bool keep_on_error) {
+                                   bool keep_on_error, bool use_mmap) {
+  std::unique_ptr<DataSet> dset(new DataSet);
+  try {
+    dset->attachToFile(filename, use_mmap);
+    dset->loadDicomFile(load_until);
+  } catch (DicomException&) {
+    if (!keep_on_error) throw;
+    // if keep_on_error is true, ignore exception and return partially decoded
+    // DataSet.
+  }
+  return dset;
+}
+
+std::unique_ptr<DataSet> open_file(const char* filename,
+                                   const std::vector<tag_t>& tags,
+                                   bool keep_on_error, bool use_mmap) {
   std::unique_ptr<DataSet> dset(new DataSet);
+  dset->setLoadTags(tags);
+  tag_t load_until = 0xffffffff;
+  if (!tags.empty())
+    load_until = std::max(*std::max_element(tags.begin(), tags.end()),
+                          tag_t(0x00280100));
   try {
-    dset->attachToFile(filename);
+    dset->attachToFile(filename, use_mmap);
     dset->loadDicomFile(load_until);
   } catch (DicomException&) {
     if (!keep_on_error) throw;
@@ -1381,11 +1579,55 @@ std::unique_ptr<DataSet> open_memory(const uint8_t* data, size_t datasize,
   return dset;
 }
 
-static void wordswap(uint8_t* ptr, size_t size) {
-  uint16_t *word = (uint16_t *)ptr;
-  size /= 2;
-  for (size_t i = 0; i < size; ++i)
-    word[i] = bswap16(word[i]);
+std::vector<std::unique_ptr<DataSet>> open_files(
+    const std::vector<std::string>& filenames, tag_t load_until, int nthreads,
+    bool keep_on_error, std::vector<std::string>* errors) {
+  std::vector<std::unique_ptr<DataSet>> dsets(filenames.size());
+  if (errors) errors->assign(filenames.size(), std::string());
+
+  parallel_for(filenames.size(), nthreads, [&](size_t i) {
+    std::unique_ptr<DataSet> dset(new DataSet);
+    try {
+      dset->attachToFile(filenames[i].c_str());
+      dset->loadDicomFile(load_until);
+    } catch (std::exception& e) {
+      // an error in a file doesn't stop loading other files.
+      if (errors) (*errors)[i] = e.what();
+      if (!keep_on_error) dset.reset();
+    }
+    dsets[i] = std::move(dset);
+  });
+
+  return dsets;
+}
+
+std::unique_ptr<DataSet> scan_header(const char* filename, tag_t stop_tag,
+                                     size_t max_bytes, size_t* bytes_read) {
+  std::unique_ptr<DataSet> dset(new DataSet);
+  dset->attachToFile(filename);
+  InFileStream* ifs = dynamic_cast<InFileStream*>(dset->instream());
+  ifs->set_exact_read(true);
+  if (max_bytes) ifs->set_read_limit(max_bytes);
+
+  try {
+    // elements up to (stop_tag - 1) are loaded; load() stops just after
+    // reading the tag of `stop_tag`.
+    dset->loadDicomFile(stop_tag ? stop_tag - 1 : 0);
+  } catch (DicomException&) {
+    // a header that is cut by `max_bytes` is returned partially; i.e. the
+    // failed request ran past `max_bytes` but not past the end of the file.
+    // other errors, e.g. a broken element before the limit, are thrown.
+    size_t failed_end = ifs->failed_end();
+    if (!max_bytes || ifs->end() != max_bytes || failed_end <= max_bytes ||
+        failed_end > ifs->filesize())
+      throw;
+  }
+  // the limit is for parsing only; values that were cut by it, or skipped,
+  // are read in full when they are accessed.
+  if (max_bytes) ifs->set_read_limit(0);
+
+  if (bytes_read) *bytes_read = ifs->bytes_read();
+  return dset;
 }
 
 void DataSet::copyFrameData(size_t index, uint8_t* data, int datasize,
@@ -1435,8 +1677,10 @@ void DataSet::copyFrameData(size_t index, uint8_t* data, int datasize,
       p += src_pagestep * index;
       q = data;
       for (int r = 0; r < rows; r++) {
-        ::memcpy(q, p, src_rowstep);
-        if (needswap) wordswap(q, src_rowstep);
+        if (needswap)
+          copyswap2(q, p, src_rowstep);
+        else
+          ::memcpy(q, p, src_rowstep);
         p += src_rowstep;
         q += rowstep;
       }
@@ -1449,8 +1693,10 @@ void DataSet::copyFrameData(size_t index, uint8_t* data, int datasize,
         p += src_pagestep * index + c * src_rowstep * rows;
         q = data + rowstep * rows * c;
         for (int r = 0; r < rows; r++) {
-          ::memcpy(q, p, src_rowstep);
-          if (needswap) wordswap(q, src_rowstep);
+          if (needswap)
+            copyswap2(q, p, src_rowstep);
+          else
+            ::memcpy(q, p, src_rowstep);
           p += src_rowstep;
           q += rowstep;
         }
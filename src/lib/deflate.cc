@@ -8,124 +8,275 @@
 
 #include "deflate.h"
 
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "dicom.h"
+#include "threadpool.h"
+#include "util.h"
 #include "zlib/zlib.h"
 
 namespace dicom {  //-----------------------------------------------------------
 
 #define CHUNK 0x10000
 
-void inflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
-                       size_t skip_offset) {
-  // write first skip_offset bytes without inflation
-  oss.write((const char *)data, (long)skip_offset);
-  data += skip_offset;
-  datasize -= skip_offset;
+// Size of input blocks deflated by each thread in deflate_dicomfile().
+#define DEFLATE_BLOCK_SIZE 0x20000
+// Size of the window of deflate; a block is primed with this many bytes.
+#define DEFLATE_DICT_SIZE 0x8000
 
-  // codes from zpipe.c ------------------------------------------------------
+// Sizes of input and output for each inflate() call in InInflateStream.
+#define INFLATE_INPUT_CHUNK 0x10000
+#define INFLATE_OUTPUT_CHUNK 0x40000
+// Deflate cannot compress data better than about 1032:1.
+#define INFLATE_MAX_RATIO 1032
+// Largest range of address space to reserve for inflated data.
+#define INFLATE_MAX_RESERVE \
+  (sizeof(size_t) > 4 ? (size_t)1 << 40 : (size_t)1 << 30)
 
-  int ret;
-  unsigned have;
-  z_stream strm;
-  unsigned char out[CHUNK];
+InInflateStream::InInflateStream()
+    : zstream_(nullptr),
+      zipped_offset_(0),
+      capacity_(0),
+      committed_(0),
+      finished_(true) {
+  LOG_DEBUG("++ @%p\tInInflateStream::InInflateStream()", this);
+}
 
-  strm.zalloc = Z_NULL;
-  strm.zfree = Z_NULL;
-  strm.opaque = Z_NULL;
-  strm.avail_in = 0;
-  strm.next_in = Z_NULL;
-  ret = inflateInit2(&strm, -15);
-  if (ret != Z_OK) goto INFLATE_END;
-
-  strm.avail_in = datasize;
-  strm.next_in = (unsigned char *)data;
-
-  do {
-    strm.avail_out = CHUNK;
-    strm.next_out = out;
-    ret = inflate(&strm, Z_NO_FLUSH);
-    // assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-    switch (ret) {
-      case Z_NEED_DICT:
-        ret = Z_DATA_ERROR; /* and fall through */
-        (void)inflateEnd(&strm);
-        goto INFLATE_END;
-        break;
-      case Z_DATA_ERROR:
-      case Z_MEM_ERROR:
-        (void)inflateEnd(&strm);
-        goto INFLATE_END;
-        break;
-      default:
-        break;
-    }
-    have = CHUNK - strm.avail_out;
-    oss.write((const char *)out, (long)have);
-  } while (strm.avail_out == 0);
+InInflateStream::~InInflateStream() {
+  release();
+  LOG_DEBUG("-- @%p\tInInflateStream::~InInflateStream()", this);
+}
 
-  (void)inflateEnd(&strm);
+void InInflateStream::release() {
+  if (zstream_) {
+    (void)inflateEnd((z_stream *)zstream_);
+    delete (z_stream *)zstream_;
+    zstream_ = nullptr;
+  }
+  if (data_) {
+    release_memory(data_, capacity_);
+    data_ = nullptr;
+  }
+  reset_internal_buffer();
+  source_.reset();
+  capacity_ = committed_ = 0;
+  finished_ = true;
+}
+
+void InInflateStream::attach(std::unique_ptr<InStream> source,
+                             size_t zipped_start) {
+  release();
+  source_ = std::move(source);
+
+  size_t source_size = source_->end();
+  if (zipped_start > source_size)
+    LOGERROR_AND_THROW(
+        "InInflateStream::attach - deflated data starts at {%#x} after the "
+        "end of file {%#x}",
+        zipped_start, source_size);
+
+  // reserve enough address space for the largest inflated data; try smaller
+  // ranges where address space is short.
+  size_t zipped_size = source_size - zipped_start;
+  size_t capacity = INFLATE_MAX_RESERVE;
+  if (zipped_size < capacity / INFLATE_MAX_RATIO)
+    capacity = zipped_size * INFLATE_MAX_RATIO;
+  capacity += zipped_start + INFLATE_OUTPUT_CHUNK;
 
-INFLATE_END:
-  if (ret != Z_STREAM_END)
-    LOGERROR_AND_THROW("inflate_dicomfile - cannot inflate file.");
+  while ((data_ = reserve_memory(capacity)) == nullptr) {
+    if (capacity / 2 < zipped_start + INFLATE_OUTPUT_CHUNK)
+      LOGERROR_AND_THROW(
+          "InInflateStream::attach - cannot reserve memory for inflated data");
+    capacity /= 2;
+  }
+  capacity_ = capacity;
 
-  oss.flush();
-  return;
+  // bytes before deflated data are not compressed.
+  if (!commit_memory(data_, zipped_start))
+    LOGERROR_AND_THROW(
+        "InInflateStream::attach - cannot commit %d bytes", zipped_start);
+  committed_ = zipped_start;
+  void *header = source_->get_pointer(0, zipped_start);
+  if (zipped_start && header == nullptr)
+    LOGERROR_AND_THROW(
+        "InInflateStream::attach - cannot read %d bytes before deflated data",
+        zipped_start);
+  memcpy(data_, header, zipped_start);
+
+  z_stream *strm = new z_stream;
+  strm->zalloc = Z_NULL;
+  strm->zfree = Z_NULL;
+  strm->opaque = Z_NULL;
+  strm->avail_in = 0;
+  strm->next_in = Z_NULL;
+  if (inflateInit2(strm, -15) != Z_OK) {
+    delete strm;
+    LOGERROR_AND_THROW("InInflateStream::attach - cannot initialize zlib");
+  }
+  zstream_ = strm;
+  zipped_offset_ = zipped_start;
+  finished_ = false;
+
+  // the end is not known until deflated data are inflated to the end.
+  startoffset_ = offset_ = 0;
+  endoffset_ = filesize_ = capacity_;
+  loaded_bytes_ = zipped_start;
+
+  LOG_DEBUG(
+      "   @%p\tInInflateStream::attach(...)\t%d bytes deflated from {%#x}, "
+      "%d bytes reserved",
+      this, zipped_size, zipped_start, capacity_);
 }
 
-void deflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
-                       size_t skip_offset, int level) {
-  // write first skip_offset bytes without inflation
-  oss.write((const char *)data, (long)skip_offset);
-  data += skip_offset;
-  datasize -= skip_offset;
+bool InInflateStream::prefetch(size_t offset, size_t size) {
+  // Inflate from `loaded_bytes_` up to `offset` + `size`. Bytes before
+  // `loaded_bytes_` are not written any more, so readers need no lock.
+  // endoffset_ is changed once when the end of deflated data is reached.
+  std::lock_guard<std::mutex> lock(mutex_);
 
-  // codes from zpipe.c ------------------------------------------------------
+  z_stream *strm = (z_stream *)zstream_;
+  size_t target = offset + size;
+  size_t loaded = loaded_bytes_;
 
-  int ret, flush;
-  unsigned have;
-  z_stream strm;
-  // unsigned char in[CHUNK];
-  unsigned char out[CHUNK];
+  while (loaded < target && !finished_) {
+    if (strm->avail_in == 0) {
+      size_t n = source_->end() - zipped_offset_;
+      if (n > INFLATE_INPUT_CHUNK) n = INFLATE_INPUT_CHUNK;
+      strm->next_in =
+          (n ? (Bytef *)source_->get_pointer(zipped_offset_, n) : Z_NULL);
+      if (strm->next_in == Z_NULL) n = 0;
+      strm->avail_in = (uInt)n;
+      zipped_offset_ += n;
+    }
+
+    size_t n = capacity_ - loaded;
+    if (n > INFLATE_OUTPUT_CHUNK) n = INFLATE_OUTPUT_CHUNK;
+    if (loaded + n > committed_) {
+      size_t commit = capacity_ - committed_;
+      if (commit > INFLATE_OUTPUT_CHUNK * 4) commit = INFLATE_OUTPUT_CHUNK * 4;
+      if (commit_memory(data_ + committed_, commit)) committed_ += commit;
+      if (loaded + n > committed_) n = committed_ - loaded;
+    }
+
+    strm->next_out = data_ + loaded;
+    strm->avail_out = (uInt)n;
+    int ret = (n ? inflate(strm, Z_NO_FLUSH) : Z_MEM_ERROR);
+    loaded += n - strm->avail_out;
+    loaded_bytes_ = loaded;
+
+    if (ret == Z_STREAM_END) {
+      finished_ = true;
+      endoffset_ = filesize_ = loaded;
+      LOG_DEBUG("   @%p\tInInflateStream::prefetch() inflated %d bytes",
+                this, loaded);
+    } else if (ret != Z_OK) {
+      // Z_NEED_DICT, Z_DATA_ERROR, Z_MEM_ERROR or Z_BUF_ERROR (input is
+      // truncated; more input is given whenever it is used up); data
+      // inflated so far remain readable.
+      finished_ = true;
+      endoffset_ = filesize_ = loaded;
+      LOGERROR_AND_THROW(
+          "InInflateStream::prefetch - cannot inflate file at {%#x}",
+          zipped_offset_);
+    }
+  }
+
+  return target <= loaded;
+}
+
+// Deflate bytes [start, start + size) of `is` into `out` as a part of a raw
+// deflate stream which begins at `zipped_start`. Up to 32 KB of bytes of the
+// stream just before `start` are set as the dictionary, which later bytes may
+// refer to. A part other than the last ends
+// with an empty stored block (Z_SYNC_FLUSH) on a byte boundary, so parts can
+// be concatenated. Input is copied from `is` in pieces of DEFLATE_BLOCK_SIZE.
+static void _deflate_part(const OutStream &is, size_t zipped_start,
+                          size_t start, size_t size, int level, bool last,
+                          std::string &out) {
+  size_t dictsize = std::min(start - zipped_start, (size_t)DEFLATE_DICT_SIZE);
+  std::vector<uint8_t> in(
+      std::max(dictsize, std::min(size, (size_t)DEFLATE_BLOCK_SIZE)));
+  is.copy_to(start - dictsize, dictsize, in.data());
 
-  /* allocate deflate state */
+  z_stream strm;
   strm.zalloc = Z_NULL;
   strm.zfree = Z_NULL;
   strm.opaque = Z_NULL;
-  ret = deflateInit2(&strm, level, Z_DEFLATED, -15, MAX_MEM_LEVEL,
-                     Z_DEFAULT_STRATEGY);
-  if (ret != Z_OK) goto DEFLATE_END;
-
-  strm.avail_in = datasize;
-  flush = Z_FINISH;
-  strm.next_in = (unsigned char *)data;
-
-  /* run deflate() on input until output buffer not full, finish
-   compression if all of source has been read in */
-  do {
-    strm.avail_out = CHUNK;
-    strm.next_out = out;
-    ret = deflate(&strm, flush); /* no bad return value */
-    // assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-    have = CHUNK - strm.avail_out;
-    oss.write((const char *)out, (long)have);
-  } while (strm.avail_out == 0);
-  // assert(strm.avail_in == 0);     /* all input will be used */
-
-  /* done when last data in file processed */
-  // assert(ret == Z_STREAM_END);        /* stream will be complete */
-  /* clean up and return */
-  (void)deflateEnd(&strm);
-  // return Z_OK;
+  if (deflateInit2(&strm, level, Z_DEFLATED, -15, MAX_MEM_LEVEL,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    LOGERROR_AND_THROW("deflate_dicomfile - cannot initialize zlib");
+  if (dictsize &&
+      deflateSetDictionary(&strm, (const Bytef *)in.data(), (uInt)dictsize) !=
+          Z_OK) {
+    (void)deflateEnd(&strm);
+    LOGERROR_AND_THROW("deflate_dicomfile - cannot set dictionary");
+  }
 
-  // build return value -----------------------
+  unsigned char buf[CHUNK];
+  int ret = Z_OK;
+  size_t end = start + size;
+  try {
+    do {
+      size_t n = std::min(end - start, (size_t)DEFLATE_BLOCK_SIZE);
+      is.copy_to(start, n, in.data());
+      start += n;
+
+      int flush =
+          (start < end ? Z_NO_FLUSH : (last ? Z_FINISH : Z_SYNC_FLUSH));
+      strm.next_in = (Bytef *)in.data();
+      strm.avail_in = (uInt)n;
+      do {
+        strm.avail_out = CHUNK;
+        strm.next_out = buf;
+        ret = deflate(&strm, flush);
+        out.append((const char *)buf, CHUNK - strm.avail_out);
+      } while (strm.avail_out == 0);
+    } while (start < end);
+  } catch (...) {
+    (void)deflateEnd(&strm);
+    throw;
+  }
+  (void)deflateEnd(&strm);
 
-DEFLATE_END:
-  if (ret != Z_STREAM_END)
+  if (ret != (last ? Z_STREAM_END : Z_OK))
     LOGERROR_AND_THROW("deflate_dicomfile - cannot deflate file.");
+}
+
+void deflate_dicomfile(const OutStream &is, OutStream &os, size_t skip_offset,
+                       int level, int nthreads) {
+  // write first skip_offset bytes without deflation
+  std::vector<uint8_t> header(skip_offset);
+  is.copy_to(0, skip_offset, header.data());
+  os.write(header.data(), skip_offset);
+  size_t datasize = is.tell() - skip_offset;
+
+  // Like pigz, blocks are deflated independently in threads, each primed
+  // with 32 KB of bytes before it, and concatenated in order. Blocks may
+  // span several segments of `is`; nothing is flattened into one buffer.
+  size_t nblocks = 1;
+  if (get_num_threads(nthreads) > 1)
+    nblocks = (datasize + DEFLATE_BLOCK_SIZE - 1) / DEFLATE_BLOCK_SIZE;
+  if (nblocks <= 1) {
+    std::string out;
+    _deflate_part(is, skip_offset, skip_offset, datasize, level, true, out);
+    os.write(out.data(), out.size());
+    return;
+  }
+
+  std::vector<std::string> outs(nblocks);
+  parallel_for(nblocks, nthreads, [&](size_t i) {
+    size_t start = i * DEFLATE_BLOCK_SIZE;
+    size_t size = datasize - start;
+    if (size > DEFLATE_BLOCK_SIZE) size = DEFLATE_BLOCK_SIZE;
+    _deflate_part(is, skip_offset, skip_offset + start, size, level,
+                  i == nblocks - 1, outs[i]);
+  });
 
-  oss.flush();
-  return;
+  for (auto &out : outs) os.write(out.data(), out.size());
 }
 
 }  // namespace dicom
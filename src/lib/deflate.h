@@ -10,14 +10,57 @@
 #define __DEFLATE_H__
 
 #include "dicom.h"
-#include <sstream>
+#include "instream.h"
+#include "outstream.h"
+#include <memory>
+#include <mutex>
 
 namespace dicom {  //------------------------------------------------------
 
-void inflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
-                       size_t skip_offset);
-void deflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
-                       size_t skip_offset, int level);
+// InStream of a Deflated Explicit VR Little Endian file.
+// Bytes before `zipped_start` (preamble and File Meta Information) are copied
+// from the source stream and the rest are inflated only as far as prefetch()
+// is asked, directly into `data_`. Loading only the header of a file stops
+// inflating early.
+// `data_` is a reserved range of address space whose pages are used as bytes
+// are inflated, so pointers from get_pointer() stay valid. The size of the
+// inflated data is not known until the end of the deflated data is reached;
+// until then endoffset_ is the size of the reserved range.
+class InInflateStream : public InStream {
+  std::unique_ptr<InStream> source_;  // stream of the deflated file
+  void* zstream_;            // z_stream of zlib
+  size_t zipped_offset_;     // next byte to inflate in `source_`
+  size_t capacity_;          // size of the reserved range of `data_`
+  size_t committed_;         // bytes of `data_` committed by commit_memory()
+  bool finished_;            // true after end of deflated data
+  std::mutex mutex_;         // serializes prefetch() from several threads.
+
+  void release();
+
+ public:
+  InInflateStream();
+  virtual ~InInflateStream();
+
+  // Take `source` and inflate from `zipped_start` of it. `source` is
+  // released if this throws.
+  void attach(std::unique_ptr<InStream> source, size_t zipped_start);
+  bool prefetch(size_t offset, size_t size);
+  int source_file_descriptor() const {
+    return source_ ? source_->source_file_descriptor() : -1;
+  }
+#ifdef _WIN32
+  void* source_file_handle() const {
+    return source_ ? source_->source_file_handle() : NULL;
+  }
+#endif
+};
+
+// Write first `skip_offset` bytes of `is` to `os` as they are and the rest as
+// a raw deflate stream with compression `level`, using `nthreads` threads
+// (number of cores if `nthreads` <= 0). Bytes of `is` are read block by block
+// from its segments.
+void deflate_dicomfile(const OutStream &is, OutStream &os, size_t skip_offset,
+                       int level, int nthreads);
 
 }  // namespace dicom -----------------------------------------------------
 
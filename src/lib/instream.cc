@@ -10,13 +10,26 @@
 
 #include <stdio.h>
 
+#include <algorithm>
+
 #ifdef _WIN32
 #include <errno.h>
+#include <io.h>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef ERROR  // conflicts with LogLevel::ERROR
 #else
+#include <fcntl.h>
 #include <sys/errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #include "dicom.h"
+#include "util.h"
 
 namespace dicom {  // ----------------------------------------------------------
 
@@ -30,6 +43,7 @@ InStream::InStream()
       own_data_(false),
       filesize_(0),
       loaded_bytes_(0),
+      failed_end_(0),
       basestream_(this),
       rootstream_(this) {
   LOG_DEBUG("++ @%p\tInStream::InStream()", this);
@@ -42,35 +56,28 @@ InStream::~InStream() {
 
 void InStream::reset_internal_buffer() {
   startoffset_ = offset_ = endoffset_ = filesize_ = loaded_bytes_ = 0;
+  failed_end_ = 0;
   if (own_data_) free(data_);
   own_data_ = false;
   data_ = nullptr;
 }
 
 size_t InStream::read(uint8_t *ptr, size_t size) {
-  if (offset_ + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset_ + size`.
-    rootstream_->prefetch(offset_ + size);
-
-    if (offset_ + size > rootstream_->loaded_bytes_) return 0;
+  if (offset_ + size > endoffset_) {
+    note_past_end(offset_ + size);
+    return 0;
   }
 
-  if (offset_ + size <= endoffset_) {
-    memcpy(ptr, rootstream_->data_ + offset_, size);
-    offset_ += size;
-    return size;
-  }
+  if (offset_ + size > rootstream_->loaded_bytes_ &&
+      !rootstream_->prefetch(offset_, size))
+    return 0;
 
-  return 0;
+  memcpy(ptr, rootstream_->data_ + offset_, size);
+  offset_ += size;
+  return size;
 }
 
 size_t InStream::seek(size_t pos) {
-  if (pos > rootstream_->loaded_bytes_) {
-    rootstream_->prefetch(pos);
-
-    if (pos > rootstream_->loaded_bytes_) return offset_;
-  }
-
   if (pos >= startoffset_ && pos <= endoffset_) {
     offset_ = pos;
   }
@@ -79,36 +86,36 @@ size_t InStream::seek(size_t pos) {
 }
 
 size_t InStream::skip(size_t size) {
-  if (offset_ + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset_ + size`.
-    rootstream_->prefetch(offset_ + size);
-
-    if (offset_ + size > rootstream_->loaded_bytes_) return 0;
-  }
-
   if (offset_ + size <= endoffset_) {
     offset_ += size;
     return size;
   }
 
+  note_past_end(offset_ + size);
   return 0;
 }
 
 void *InStream::get_pointer(size_t offset, size_t size) {
-  if (offset + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset + size`.
-    rootstream_->prefetch(offset + size);
-
-    if (offset + size > rootstream_->loaded_bytes_) return nullptr;
+  if (offset + size > endoffset_) {
+    note_past_end(offset + size);
+    return nullptr;
   }
 
-  if (offset + size <= endoffset_) {
-    return rootstream_->data_ + offset;
-  }
+  if (offset + size > rootstream_->loaded_bytes_ &&
+      !rootstream_->prefetch(offset, size))
+    return nullptr;
 
-  return nullptr;
+  return rootstream_->data_ + offset;
 }
 
+#ifdef _WIN32
+void* InStream::source_file_handle() const {
+  int fd = source_file_descriptor();
+  intptr_t h = (fd >= 0 ? _get_osfhandle(fd) : -1);
+  return (h == -1 ? NULL : (void*)h);
+}
+#endif
+
 // InStringStream ==============================================================
 
 InStringStream::InStringStream() {
@@ -148,19 +155,25 @@ void InStringStream::attachmemory(const uint8_t *data, size_t datasize,
 
 // InFileStream ================================================================
 
-InFileStream::InFileStream() : fp_(NULL), filename_("") {
+InFileStream::InFileStream()
+    : fp_(NULL),
+      filename_(""),
+      capacity_(0),
+      page_size_(INSTREAM_PAGE_SIZE),
+      bytes_read_(0) {
   LOG_DEBUG("++ @%p\tFileInStream::FileInStream()", this);
 }
 
 InFileStream::~InFileStream() {
   detachfile();
+  release_data();
   LOG_DEBUG("-- @%p\tFileInStream::~FileInStream()", this);
 }
 
 void InFileStream::attachfile(const char* filename) {
   // reset data before load a new file
-  reset_internal_buffer();
   detachfile();
+  release_data();
 
   fp_ = fopen(filename, "rb");
 
@@ -185,8 +198,27 @@ void InFileStream::attachfile(const char* filename) {
   LOG_DEBUG("++ @%p\tFileInStream::attachfile(const char*)\t %s", this,
             filename_.c_str());
 
-  prefetch(INITIAL_INSTREAM_DATABUFFER_SIZE);
-  own_data_ = true;
+  // Only address space is reserved for the file; pages are committed as
+  // bytes are read into them by read_range().
+  capacity_ = (filesize_ ? filesize_ : 1);
+  data_ = reserve_memory(capacity_);
+  if (data_ == NULL) {
+    capacity_ = 0;
+    detachfile();
+    LOGERROR_AND_THROW(
+        "cannot reserve %d bytes in InFileStream::attachfile", filesize_);
+  }
+  own_data_ = false;  // released in release_data(), not free()'d.
+  extents_.clear();
+  loaded_bytes_ = bytes_read_ = 0;
+}
+
+// release the reservation of `data_`; bytes read from file are lost.
+void InFileStream::release_data() {
+  if (data_) release_memory(data_, capacity_);
+  data_ = nullptr;
+  capacity_ = 0;
+  reset_internal_buffer();
 }
 
 // close file -- memory chunk is preserved
@@ -200,50 +232,203 @@ void InFileStream::detachfile() {
   filename_ = "";
 }
 
-void InFileStream::prefetch(size_t newsize) {
-  // `prefetch` updates `data_` and `loaded_bytes_`.
-  // InSubStream should use `rootstream_->data_` rather than it's own `data_`
-  // and `loaded_bytes_`.
-  if (newsize < loaded_bytes_) return;
+// read bytes [start, end) from file into `data_`.
+void InFileStream::read_range(size_t start, size_t end) {
+  size_t size = end - start;
 
-  size_t new_loaded_bytes =
-      (loaded_bytes_ > 0 ? loaded_bytes_ * 2
-                         : INITIAL_INSTREAM_DATABUFFER_SIZE);
-  while (new_loaded_bytes < newsize) new_loaded_bytes *= 2;
+  if (fp_ == NULL) {
+    LOGERROR_AND_THROW(
+        "cannot read %d bytes from \"%s\":%d; file is already detached",
+        size, filename_.c_str(), start);
+  }
+
+  if (!commit_memory(data_ + start, size)) {
+    LOGERROR_AND_THROW("cannot commit %d bytes for \"%s\":%d", size,
+                       filename_.c_str(), start);
+  }
 
-  if (new_loaded_bytes > filesize_) new_loaded_bytes = filesize_;
+  size_t nread = 0;
+#ifdef _WIN32
+  if (_fseeki64(fp_, (__int64)start, SEEK_SET) == 0)
+    nread = fread(data_ + start, 1, size, fp_);
+#else
+  int fd = fileno(fp_);
+  while (nread < size) {
+    ssize_t n = pread(fd, data_ + start + nread, size - nread,
+                      (off_t)(start + nread));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    nread += (size_t)n;
+  }
+#endif
 
-  uint8_t *tmpdata = (uint8_t *)realloc(data_, new_loaded_bytes);
-  if (tmpdata == NULL) {
+  if (nread < size) {
     LOGERROR_AND_THROW(
-        "cannot realloc %d bytes in InFileStream::prefetch",
-        new_loaded_bytes);
+        "cannot read %d bytes from \"%s\":%d in InFileStream::prefetch", size,
+        filename_.c_str(), start);
+  }
+
+  LOG_DEBUG("   @%p\tInFileStream::prefetch() read %d bytes at {%#x}", this,
+            size, start);
+  bytes_read_ += size;
+}
+
+bool InFileStream::prefetch(size_t offset, size_t size) {
+  // `prefetch` fills `data_` and updates `loaded_bytes_`.
+  // InSubStream should use `rootstream_->data_` rather than it's own `data_`
+  // and `loaded_bytes_`.
+  // Threads may call this at the same time for values of a DataSet; bytes
+  // outside of the gaps being read are not written, so readers of loaded
+  // bytes need no lock.
+  if (offset + size > endoffset_) return false;
+  if (size == 0) return true;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  size_t start = offset - offset % page_size_;
+  size_t end = offset + size + page_size_ - 1;
+  end -= end % page_size_;
+  if (end > endoffset_) end = endoffset_;
+
+  // first extent which may overlap or touch [start, end).
+  auto it = std::lower_bound(
+      extents_.begin(), extents_.end(), start,
+      [](const std::pair<size_t, size_t> &e, size_t v) { return e.second < v; });
+
+  // read each gap between extents in [start, end) and merge the extents.
+  size_t pos = start;
+  auto first = it;
+  while (it != extents_.end() && it->first <= end) {
+    if (pos < it->first) read_range(pos, it->first);
+    if (it->second > pos) pos = it->second;
+    ++it;
   }
+  if (pos < end) read_range(pos, end);
 
-#ifdef DEBUG_MESSAGE
-  if (data_ && data_ != tmpdata) {
-    LOG_DEBUG("   @%p\tInStream::prefetch() old data @%p -> new data @%p", this,
-              data_, tmpdata);
+  std::pair<size_t, size_t> merged(start, end);
+  if (first != it) {
+    if (first->first < merged.first) merged.first = first->first;
+    if ((it - 1)->second > merged.second) merged.second = (it - 1)->second;
   }
+  first = extents_.erase(first, it);
+  extents_.insert(first, merged);
+
+  if (extents_.front().first == 0) loaded_bytes_ = extents_.front().second;
+
+  return true;
+}
+
+// InMmapStream ================================================================
+
+InMmapStream::InMmapStream()
+#ifdef _WIN32
+    : hfile_(INVALID_HANDLE_VALUE), hmap_(NULL), filename_("") {
+#else
+    : fd_(-1), filename_("") {
 #endif
+  LOG_DEBUG("++ @%p\tInMmapStream::InMmapStream()", this);
+}
 
-  data_ = tmpdata;
-  size_t nread =
-      fread(data_ + loaded_bytes_, 1, new_loaded_bytes - loaded_bytes_, fp_);
+InMmapStream::~InMmapStream() {
+  detachfile();
+  LOG_DEBUG("-- @%p\tInMmapStream::~InMmapStream()", this);
+}
 
-  if (nread < new_loaded_bytes - loaded_bytes_) {
-    LOGERROR_AND_THROW(
-        "cannot fread %d bytes from \"%s\":%d in InFileStream::prefetch",
-        (new_loaded_bytes - loaded_bytes_), filename_.c_str(), loaded_bytes_);
+void InMmapStream::attachfile(const char *filename) {
+  // reset data before map a new file
+  detachfile();
+  reset_internal_buffer();
+
+  size_t fileLength;
+
+#ifdef _WIN32
+  // FILE_SHARE_DELETE lets DataSet::saveToFile() try to replace the file.
+  hfile_ = CreateFileA(filename, GENERIC_READ,
+                       FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hfile_ == INVALID_HANDLE_VALUE) {
+    LOGERROR_AND_THROW("cannot open \"%s\": error code %lu", filename,
+                       (unsigned long)GetLastError());
   }
 
-  LOG_DEBUG(
-      "   @%p\tInStream::prefetch() read +%d bytes, data %p, loaded_bytes_ %d, "
-      "new_loaded_bytes %d",
-      this, new_loaded_bytes - loaded_bytes_, data_, loaded_bytes_,
-      new_loaded_bytes);
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx((HANDLE)hfile_, &size)) {
+    detachfile();
+    LOGERROR_AND_THROW("cannot get size of \"%s\"", filename);
+  }
+  fileLength = (size_t)size.QuadPart;
+
+  if (fileLength) {
+    hmap_ = CreateFileMappingA((HANDLE)hfile_, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hmap_ != NULL)
+      data_ = (uint8_t *)MapViewOfFile((HANDLE)hmap_, FILE_MAP_READ, 0, 0, 0);
+    if (data_ == NULL) {
+      detachfile();
+      LOGERROR_AND_THROW("cannot mmap \"%s\": error code %lu", filename,
+                         (unsigned long)GetLastError());
+    }
+  }
+#else
+  fd_ = open(filename, O_RDONLY);
+  if (fd_ < 0) {
+    char *errmsg = strerror(errno);
+    LOGERROR_AND_THROW("cannot open \"%s\": %s", filename, errmsg);
+  }
+
+  struct stat st;
+  if (fstat(fd_, &st) != 0) {
+    detachfile();
+    LOGERROR_AND_THROW("cannot get size of \"%s\"", filename);
+  }
+  fileLength = (size_t)st.st_size;
+
+  // mmap() refuses zero length; an empty file stays invalid (`data_` is null).
+  if (fileLength) {
+    void *ptr = mmap(NULL, fileLength, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (ptr == MAP_FAILED) {
+      char *errmsg = strerror(errno);
+      detachfile();
+      LOGERROR_AND_THROW("cannot mmap \"%s\": %s", filename, errmsg);
+    }
+    data_ = (uint8_t *)ptr;
+  }
+#endif
+
+  filename_ = filename;
+  own_data_ = false;  // unmapped in detachfile(), not free()'d.
+  startoffset_ = offset_ = 0;
+  endoffset_ = filesize_ = loaded_bytes_ = fileLength;
+
+  LOG_DEBUG("++ @%p\tInMmapStream::attachfile(const char*)\t %s, %d bytes",
+            this, filename_.c_str(), filesize_);
+}
 
-  loaded_bytes_ = new_loaded_bytes;
+#ifdef _WIN32
+void* InMmapStream::source_file_handle() const {
+  return (hfile_ == INVALID_HANDLE_VALUE ? NULL : hfile_);
+}
+#endif
+
+// unmap and close file -- data_ is not valid any more
+void InMmapStream::detachfile() {
+#ifdef _WIN32
+  if (data_) UnmapViewOfFile(data_);
+  if (hmap_ != NULL) CloseHandle((HANDLE)hmap_);
+  if (hfile_ != INVALID_HANDLE_VALUE) CloseHandle((HANDLE)hfile_);
+  hmap_ = NULL;
+  hfile_ = INVALID_HANDLE_VALUE;
+#else
+  if (data_) munmap(data_, filesize_);
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+#endif
+  if (data_) {
+    LOG_DEBUG("-- @%p\tInMmapStream::detachfile()\t %s", this,
+              filename_.c_str());
+  }
+  data_ = nullptr;
+  reset_internal_buffer();
+  filename_ = "";
 }
 
 // InSubStream ==============================================================
@@ -267,14 +452,34 @@ InSubStream::InSubStream(InStream *basestream, size_t size) {
       this, basestream, startoffset_, size);
 }
 
+InSubStream::InSubStream(InStream *basestream, size_t offset, size_t size) {
+  basestream_ = basestream;
+  rootstream_ = basestream->rootstream();
+
+  startoffset_ = offset_ = offset;
+  endoffset_ = startoffset_ + size;
+  if (endoffset_ > basestream_->endoffset())
+    endoffset_ = basestream->endoffset();
+  data_ = nullptr;  // not used in InSubStream;
+  own_data_ = false;
+  filesize_ = 0;  // not used in InSubStream
+  loaded_bytes_ = 0; // not used in InSubStream
+
+  LOG_DEBUG(
+      "++ @%p\tInSubStream::InSubStream(InStream *, size_t, size_t)\tbase %p, "
+      "offset {%08x}, size %d",
+      this, basestream, startoffset_, size);
+}
+
 InSubStream::~InSubStream() {
   LOG_DEBUG(
       "-- @%p\tInSubStream::~InSubStream()\tbase %p, offset {%08x}, size %d",
       this, basestream_, startoffset_, endoffset_ - startoffset_);
 }
 
-void InSubStream::prefetch(size_t newsize) {
+bool InSubStream::prefetch(size_t offset, size_t size) {
   LOGERROR_AND_THROW("InSubStream::prefetch - should not be called ")
+  return false;
 }
 
 }  // namespace dicom
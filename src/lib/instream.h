@@ -9,12 +9,19 @@
 #ifndef DICOMSDL_INSTREAM_H__
 #define DICOMSDL_INSTREAM_H__
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <vector>
 #include "dicom.h"
 
 namespace dicom {  //-----------------------------------------------------------
 
-#define INITIAL_INSTREAM_DATABUFFER_SIZE  1024
+// InFileStream reads a file in pages of this size, only when touched.
+#define INSTREAM_PAGE_SIZE  16384
+// DataSet::load reads values up to this size while parsing; longer values
+// are recorded as offset and length and read when they are accessed.
+#define INSTREAM_SHORT_VALUE_LENGTH  1024
 
 // template <typename T>
 // class DataValue {
@@ -101,29 +108,40 @@ class InStream {
     < basestream_->endoffset_
 
     filesize_ == os.path.getsize(dicom file)
-    bytes_read_ <= filesize_
+    loaded_bytes_ <= filesize_
 
-    if offset_ + request data size > basestream_->bytes_read_:
-      fill more basestream_->data_ from file
-      basestream_->bytes_read_ += read bytes
+    if offset_ + request data size > rootstream_->loaded_bytes_:
+      rootstream_->prefetch(offset_, request data size)
     process request data size
+
+    skip() and seek() only move the cursor; they don't load any data.
    */
   size_t startoffset_;  // start position in this InStream
   size_t offset_;     // position of the cursor startoffset_ <= ... < endoffset_
-  size_t endoffset_;  // end position of this InStream
+  // end position of this InStream. Atomic since InInflateStream learns its
+  // end only when a thread inflates the last bytes.
+  std::atomic<size_t> endoffset_;
 
   // data_, own_data_, filesize_, loaded_bytes_ are valid only in basestream.
   uint8_t* data_;        // holds entire dicom file image.
   bool own_data_;        // need free data if own_data_ is true.
   size_t filesize_;      // size of the dicom file.
-  size_t loaded_bytes_;  // number of bytes that are loaded from disk (e.g. size
-                         // of data_)
+  // bytes [0, loaded_bytes_) of data_ are loaded from disk; bytes after may
+  // be loaded by prefetch(). Atomic so that threads can read loaded bytes
+  // while another thread is prefetching.
+  std::atomic<size_t> loaded_bytes_;
+  // end of the last request that ran past the end of a stream, or 0.
+  // valid only in rootstream.
+  std::atomic<size_t> failed_end_;
 
   InStream* basestream_;  // parent
   InStream* rootstream_;  // parent's parent's ...
 
   void reset_internal_buffer();
 
+  // remember a request for bytes up to `end` that failed.
+  inline void note_past_end(size_t end) { rootstream_->failed_end_ = end; }
+
  public:
   InStream();
   InStream(InStream& other) = delete;
@@ -138,11 +156,14 @@ class InStream {
   // return current position in the stream
   inline size_t tell() const { return offset_; }
 
-  // return true if current position is at the end of stream
-  inline bool is_eof() const { return offset_ == endoffset_; }
+  // return true if current position is at the end of stream; the end of
+  // InInflateStream may be found before the cursor after a long skip().
+  inline bool is_eof() const { return offset_ >= endoffset_; }
 
   // return number of remaining bytes
-  inline size_t bytes_remaining() const { return endoffset_ - offset_; }
+  inline size_t bytes_remaining() const {
+    return offset_ < endoffset_ ? endoffset_ - offset_ : 0;
+  }
 
   inline size_t begin() const { return startoffset_; }
 
@@ -150,6 +171,13 @@ class InStream {
 
   inline size_t loaded_bytes() const { return rootstream_->loaded_bytes_; }
 
+  // return the end of the last request of read(), skip() or get_pointer()
+  // on this stream or its sub streams that failed since it ran past the end
+  // of the stream; 0 if there was none.
+  inline size_t failed_end() const { return rootstream_->failed_end_; }
+  // return size of the file, which may be larger than end().
+  inline size_t filesize() const { return rootstream_->filesize_; }
+
   // copy 'size' bytes from the current position
   // return number of bytes read
   size_t read(uint8_t* ptr, size_t size);
@@ -163,8 +191,19 @@ class InStream {
   // TODO: write docs .....................................
   void* get_pointer(size_t offset, size_t size);
 
-  // make size of `data_` at least newsize and fill it from stream.
-  virtual void prefetch(size_t newsize) = 0;
+  // fill bytes [offset, offset + size) of `data_` from stream.
+  // return false if the range is out of the stream.
+  virtual bool prefetch(size_t offset, size_t size) = 0;
+
+  // return descriptor of the file whose bytes are the bytes of this stream
+  // at the same offsets, or -1. The file may be copied with it directly.
+  virtual int file_descriptor() const { return -1; }
+  // return descriptor of the file which this stream reads bytes from, or -1.
+  virtual int source_file_descriptor() const { return file_descriptor(); }
+#ifdef _WIN32
+  // return HANDLE of the file which this stream reads bytes from, or NULL.
+  virtual void* source_file_handle() const;
+#endif
 
   // move current position to new 'pos' and return new position.
   // if 'pos' is out of range, current position is not changed...
@@ -197,12 +236,29 @@ class InStringStream : public InStream {
   // open file and prepare memory chunk for file data
   // attach to a new file will disrupt contents in DataSet
   void attachmemory(const uint8_t* data, size_t datasize, bool copydata);
-  void prefetch(size_t) {} // entire file is already on the memory.
+  // entire file is already on the memory.
+  bool prefetch(size_t offset, size_t size) {
+    return offset + size <= loaded_bytes_;
+  }
 };
 
 class InFileStream : public InStream {
+  // `data_` is a range of address space reserved for the whole file at
+  // attachfile(); pages of it are committed and read with pread() only when
+  // they are touched by read() or get_pointer(), so skipped values (e.g.
+  // pixel data) take no memory. Pointers into `data_` stay valid until the
+  // stream is destroyed or attached to another file.
   FILE* fp_;
   std::string filename_;
+  size_t capacity_;    // size of the reserved range of `data_`
+  // sorted, disjoint and non-adjacent [start, end) ranges read from file.
+  std::vector<std::pair<size_t, size_t>> extents_;
+  size_t page_size_;   // granularity of reads; 1 reads exact ranges.
+  size_t bytes_read_;  // number of bytes read from file.
+  std::mutex mutex_;   // serializes prefetch() from several threads.
+
+  void read_range(size_t start, size_t end);
+  void release_data();
 
  public:
   InFileStream();
@@ -212,16 +268,64 @@ class InFileStream : public InStream {
   // attach to a new file will disrupt contents in DataSet
   void attachfile(const char* filename);
   void detachfile();
-  void prefetch(size_t newsize);
+  bool prefetch(size_t offset, size_t size);
+  int file_descriptor() const { return fp_ ? fileno(fp_) : -1; }
+
+  // Options below are not guarded by `mutex_`; set them after attachfile()
+  // and before the stream is shared with other threads.
+
+  // read only the bytes that are asked rather than whole pages.
+  void set_exact_read(bool exact) {
+    page_size_ = exact ? 1 : INSTREAM_PAGE_SIZE;
+  }
+  // don't read bytes at or after `limit`; the stream ends there.
+  // 0 removes the limit.
+  void set_read_limit(size_t limit) {
+    endoffset_ = (limit && limit < filesize_) ? limit : filesize_;
+  }
+  inline size_t bytes_read() const { return bytes_read_; }
+};
+
+class InMmapStream : public InStream {
+  // `data_` points to the read-only mapping of the whole file; `prefetch`
+  // has nothing to do and pointers from `get_pointer` are stable.
+#ifdef _WIN32
+  void* hfile_;
+  void* hmap_;
+#else
+  int fd_;
+#endif
+  std::string filename_;
+
+ public:
+  InMmapStream();
+  virtual ~InMmapStream();
+
+  // open file and map it into memory
+  // attach to a new file will disrupt contents in DataSet
+  void attachfile(const char* filename);
+  void detachfile();
+  // entire file is already mapped.
+  bool prefetch(size_t offset, size_t size) {
+    return offset + size <= loaded_bytes_;
+  }
+#ifdef _WIN32
+  int file_descriptor() const { return -1; }
+  void* source_file_handle() const;
+#else
+  int file_descriptor() const { return fd_; }
+#endif
 };
 
 class InSubStream : public InStream {
   // any operation during InSubStream don't change basestream's offset
  public:
   InSubStream(InStream *basestream, size_t size);
+  // Sub stream of `size` bytes from `offset` of `basestream`.
+  InSubStream(InStream *basestream, size_t offset, size_t size);
   virtual ~InSubStream();
 
-  void prefetch(size_t newsize);
+  bool prefetch(size_t offset, size_t size);
 };
 
 
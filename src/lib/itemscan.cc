@@ -0,0 +1,130 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * itemscan.cc
+ */
+
+#include <vector>
+
+#include "dicom.h"
+#include "instream.h"
+#include "itemscan.h"
+
+namespace dicom {
+
+// What the scanner expects at the current offset.
+enum { SCAN_ITEMS, SCAN_ELEMENTS };
+
+size_t find_items_end(InStream* instream, size_t offset, bool is_explicit_vr,
+                      bool is_little_endian) {
+  const size_t end = instream->end();
+
+  // If the whole stream is on the memory (InStringStream, InMmapStream or
+  // already loaded InFileStream), walk headers on the buffer directly.
+  // Otherwise get each header through get_pointer() so that only pages with
+  // headers are read from the file.
+  const uint8_t* base =
+      (end <= instream->loaded_bytes() ? instream->data() : nullptr);
+  auto header = [&](size_t pos, size_t size) -> uint8_t* {
+    if (size > end - pos) return nullptr;
+    if (base) return (uint8_t*)base + pos;
+    return (uint8_t*)instream->get_pointer(pos, size);
+  };
+
+  std::vector<uint8_t> scope;  // SCAN_ITEMS or SCAN_ELEMENTS for each level
+  scope.reserve(16);
+  scope.push_back(SCAN_ITEMS);
+
+  while (!scope.empty()) {
+    uint8_t* p = header(offset, 8);
+    if (!p) return end;
+
+    tag_t tag = TAG::load_32e(p, is_little_endian);
+    size_t length;
+
+    if (scope.back() == SCAN_ITEMS) {
+      if (tag == 0xfffee0dd) {  // Seq. Delim. Tag
+        offset += 8;
+        scope.pop_back();
+        continue;
+      }
+      if (tag != 0xfffee000) {  // not an Item Tag; quit like Sequence::load
+        scope.pop_back();
+        continue;
+      }
+      length = load_e<uint32_t>(p + 4, is_little_endian);
+      offset += 8;
+      if (length == 0xffffffff) {
+        scope.push_back(SCAN_ELEMENTS);
+        continue;
+      }
+    } else {
+      if (tag == 0xfffee00d) {  // Item Delim. Tag
+        offset += 8;
+        scope.pop_back();
+        continue;
+      }
+      if (tag == 0xfffee0dd) {  // Seq. Delim. Tag; item is not closed
+        scope.pop_back();
+        continue;
+      }
+
+      // same rules as DataSet::load for VR and value length.
+      size_t header_size = 8;
+      if (!is_explicit_vr) {
+        length = load_le<uint32_t>(p + 4);
+      } else {
+        length = load_e<uint16_t>(p + 6, is_little_endian);
+        switch (VR::from_uint16le(uint16_t(p[4]) + uint16_t(p[5]) * 256)) {
+          case VR::FL: case VR::FD: case VR::SL: case VR::UL: case VR::SS:
+          case VR::US: case VR::AE: case VR::AS: case VR::AT: case VR::CS:
+          case VR::DA: case VR::DS: case VR::DT: case VR::IS: case VR::LO:
+          case VR::LT: case VR::PN: case VR::SH: case VR::ST: case VR::TM:
+          case VR::UI:
+            break;
+
+          case VR::OB: case VR::OD: case VR::OF: case VR::OL: case VR::OV:
+          case VR::OW: case VR::SQ: case VR::UN: case VR::SV: case VR::UC:
+          case VR::UR: case VR::UV:
+            p = header(offset, 12);
+            if (!p) return end;
+            length = load_e<uint32_t>(p + 8, is_little_endian);
+            header_size = 12;
+            break;
+
+          case VR::UT:
+            // In a strange implementation, VR 'UT' takes 2 bytes for 'len'
+            p = header(offset, 12);
+            if (!p) return end;
+            if (load_e<uint32_t>(p + 8, is_little_endian) <=
+                end - offset - 12) {
+              length = load_e<uint32_t>(p + 8, is_little_endian);
+              header_size = 12;
+            }
+            break;
+
+          default:
+            // 'UK' has 2 bytes length; otherwise assume implicit VR.
+            if (!(p[4] == 'U' && p[5] == 'K'))
+              length = load_le<uint32_t>(p + 4);
+            break;
+        }
+      }
+      offset += header_size;
+      if (length == 0xffffffff) {
+        scope.push_back(SCAN_ITEMS);
+        continue;
+      }
+    }
+
+    // jump over the value of an item or an element.
+    if (length > end - offset) return end;
+    offset += length;
+  }
+
+  return offset;
+}
+
+}  // namespace dicom
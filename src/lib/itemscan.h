@@ -0,0 +1,32 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * itemscan.h
+ */
+
+#ifndef DICOMSDL_ITEMSCAN_H__
+#define DICOMSDL_ITEMSCAN_H__
+
+#include <stddef.h>
+
+#include "instream.h"
+
+namespace dicom {
+
+// Find the end of items of a sequence (or a pixel sequence) with undefined
+// length whose first item starts at `offset` of `instream`.
+// Element headers are walked and values are jumped over by their lengths;
+// no DataSet or DataElement is created and the cursor of `instream` is not
+// moved. Nested sequences and items with undefined length are followed
+// without recursion.
+// Returns the offset just after the Seq. Delim. Tag (FFFE,E0DD), or the
+// offset of the first tag which is not an item, like Sequence::load().
+// Returns the end of `instream` if items are truncated.
+size_t find_items_end(InStream* instream, size_t offset, bool is_explicit_vr,
+                      bool is_little_endian);
+
+}  // namespace dicom
+
+#endif  // DICOMSDL_ITEMSCAN_H__
@@ -0,0 +1,295 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * outstream.cc
+ */
+
+#include "outstream.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+#endif
+
+#ifdef __linux__
+#include <sys/sendfile.h>
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define OUTSTREAM_COPY_FILE_RANGE
+#endif
+#endif
+
+#include "dicom.h"
+#include "instream.h"
+
+namespace dicom {  // ----------------------------------------------------------
+
+#ifdef __linux__
+// Copy `size` bytes at `offset` of file `src` to `fd` in the kernel with
+// copy_file_range() or sendfile(). Return false if neither works for these
+// files before anything is copied; the caller writes the bytes instead.
+static bool _kernel_copy(int src, size_t offset, size_t size, int fd) {
+#ifdef OUTSTREAM_COPY_FILE_RANGE
+  bool use_sendfile = false;
+#else
+  bool use_sendfile = true;
+#endif
+  size_t done = 0;
+  while (done < size) {
+    size_t chunk = size - done;
+    if (chunk > 0x40000000) chunk = 0x40000000;
+    off_t off = (off_t)(offset + done);
+    ssize_t n;
+
+    if (!use_sendfile) {
+#ifdef OUTSTREAM_COPY_FILE_RANGE
+      loff_t off_in = (loff_t)off;
+      n = copy_file_range(src, &off_in, fd, NULL, chunk, 0);
+      // e.g. files on different file systems or `fd` is a pipe.
+      if (n < 0 && done == 0 && errno != EINTR) {
+        use_sendfile = true;
+        continue;
+      }
+#endif
+    } else {
+      n = sendfile(fd, src, &off, chunk);
+      if (n < 0 && done == 0 && (errno == EINVAL || errno == ENOSYS))
+        return false;
+    }
+
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      const char *errmsg = (n < 0 ? strerror(errno) : "unexpected end of file");
+      LOGERROR_AND_THROW("OutStream::write_to - cannot copy: %s", errmsg);
+    }
+    done += (size_t)n;
+  }
+  return true;
+}
+#elif !defined(_WIN32)
+static bool _kernel_copy(int src, size_t offset, size_t size, int fd) {
+  return false;
+}
+#endif
+
+OutStream::OutStream() : size_(0) {
+  LOG_DEBUG("++ @%p\tOutStream::OutStream()", this);
+}
+
+void OutStream::write(const void *data, size_t size) {
+  if (size == 0) return;
+
+  // extend the last segment if it ends at the end of `buf_`.
+  size_t offset = buf_.size();
+  if (!segments_.empty() && segments_.back().ptr == nullptr &&
+      segments_.back().source == nullptr &&
+      segments_.back().offset + segments_.back().size == offset)
+    segments_.back().size += size;
+  else
+    segments_.push_back({nullptr, nullptr, offset, size, size_});
+
+  buf_.insert(buf_.end(), (const uint8_t *)data,
+              (const uint8_t *)data + size);
+  size_ += size;
+}
+
+void OutStream::write_ref(const void *data, size_t size) {
+  if (size < OUTSTREAM_COPY_SIZE) {
+    write(data, size);
+    return;
+  }
+  segments_.push_back({(const uint8_t *)data, nullptr, 0, size, size_});
+  size_ += size;
+}
+
+void OutStream::write_source(InStream *source, size_t offset, size_t size) {
+  if (size == 0) return;
+
+  if (!segments_.empty() && segments_.back().source == source &&
+      segments_.back().offset + segments_.back().size == offset)
+    segments_.back().size += size;
+  else
+    segments_.push_back({nullptr, source, offset, size, size_});
+  size_ += size;
+}
+
+const uint8_t *OutStream::segment_data(const Segment &seg) const {
+  if (seg.ptr) return seg.ptr;
+  if (seg.source == nullptr) return buf_.data() + seg.offset;
+
+  const uint8_t *p = (const uint8_t *)seg.source->get_pointer(seg.offset,
+                                                              seg.size);
+  if (p == nullptr)
+    LOGERROR_AND_THROW(
+        "OutStream - cannot read %d bytes at {%#x} of the source stream",
+        seg.size, seg.offset);
+  return p;
+}
+
+void OutStream::copy_to(size_t pos, size_t size, void *dst) const {
+  if (pos + size > size_)
+    LOGERROR_AND_THROW(
+        "OutStream::copy_to - cannot copy %d bytes at {%#x} of %d bytes", size,
+        pos, size_);
+  if (size == 0) return;
+
+  // the segment which holds `pos` is the last one that starts at or before it.
+  size_t index = std::upper_bound(segments_.begin(), segments_.end(), pos,
+                                  [](size_t pos, const Segment &seg) {
+                                    return pos < seg.pos;
+                                  }) -
+                 segments_.begin() - 1;
+  uint8_t *d = (uint8_t *)dst;
+  while (size) {
+    const Segment &seg = segments_[index++];
+    size_t skip = pos - seg.pos;
+    size_t n = seg.size - skip;
+    if (n > size) n = size;
+
+    const uint8_t *p;
+    if (seg.ptr)
+      p = seg.ptr + skip;
+    else if (seg.source == nullptr)
+      p = buf_.data() + seg.offset + skip;
+    else
+      p = (const uint8_t *)seg.source->get_pointer(seg.offset + skip, n);
+    if (p == nullptr)
+      LOGERROR_AND_THROW(
+          "OutStream - cannot read %d bytes at {%#x} of the source stream", n,
+          seg.offset + skip);
+
+    memcpy(d, p, n);
+    d += n;
+    pos += n;
+    size -= n;
+  }
+}
+
+OutStream::LengthMarker OutStream::mark_length() const {
+  if (segments_.empty() || segments_.back().ptr != nullptr ||
+      segments_.back().source != nullptr || segments_.back().size < 4)
+    LOGERROR_AND_THROW(
+        "OutStream::mark_length - last 4 bytes are not in the buffer");
+  return {size_, buf_.size() - 4};
+}
+
+void OutStream::fill_length(const LengthMarker &marker,
+                            bool is_little_endian) {
+  store_e<uint32_t>(&buf_[marker.offset], (uint32_t)(size_ - marker.pos),
+                    is_little_endian);
+}
+
+void OutStream::clear() {
+  buf_.clear();
+  segments_.clear();
+  size_ = 0;
+}
+
+void OutStream::swap(OutStream &other) {
+  buf_.swap(other.buf_);
+  segments_.swap(other.segments_);
+  std::swap(size_, other.size_);
+}
+
+std::string OutStream::str() const {
+  std::string s;
+  s.reserve(size_);
+  for (const auto &seg : segments_) {
+    const uint8_t *p = segment_data(seg);
+    s.append((const char *)p, seg.size);
+  }
+  return s;
+}
+
+void OutStream::write_to(std::ostream &os) const {
+  for (const auto &seg : segments_) {
+    const uint8_t *p = segment_data(seg);
+    os.write((const char *)p, (std::streamsize)seg.size);
+  }
+  os.flush();
+}
+
+void OutStream::write_to(int fd) const {
+#ifdef _WIN32
+  for (const auto &seg : segments_) {
+    const uint8_t *p = segment_data(seg);
+    size_t remaining = seg.size;
+    while (remaining) {
+      unsigned int n = (remaining > 0x40000000 ? 0x40000000 : remaining);
+      int written = _write(fd, p, n);
+      if (written <= 0) {
+        char *errmsg = strerror(errno);
+        LOGERROR_AND_THROW("OutStream::write_to - cannot write: %s", errmsg);
+      }
+      p += written;
+      remaining -= written;
+    }
+  }
+#else
+  size_t index = 0;
+  while (index < segments_.size()) {
+    const Segment &seg = segments_[index];
+    if (seg.source && seg.source->file_descriptor() >= 0 &&
+        _kernel_copy(seg.source->file_descriptor(), seg.offset, seg.size,
+                     fd)) {
+      index++;
+      continue;
+    }
+
+    // gather segments up to the next range of a file in each writev().
+    size_t end = index + 1;
+    while (end < segments_.size() && end - index < IOV_MAX &&
+           !(segments_[end].source &&
+             segments_[end].source->file_descriptor() >= 0))
+      end++;
+    _writev(fd, index, end);
+    index = end;
+  }
+#endif
+}
+
+#ifndef _WIN32
+void OutStream::_writev(int fd, size_t begin, size_t end) const {
+  std::vector<struct iovec> iov(end - begin);
+  for (size_t i = begin; i < end; i++) {
+    iov[i - begin].iov_base = (void *)segment_data(segments_[i]);
+    iov[i - begin].iov_len = segments_[i].size;
+  }
+
+  // a partial write resumes from the segment where it stopped.
+  size_t index = 0;
+  while (index < iov.size()) {
+    ssize_t n = writev(fd, &iov[index], (int)(iov.size() - index));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      char *errmsg = strerror(errno);
+      LOGERROR_AND_THROW("OutStream::write_to - cannot write: %s", errmsg);
+    }
+
+    size_t written = (size_t)n;
+    while (index < iov.size() && written >= iov[index].iov_len) {
+      written -= iov[index].iov_len;
+      index++;
+    }
+    if (written) {
+      iov[index].iov_base = (uint8_t *)iov[index].iov_base + written;
+      iov[index].iov_len -= written;
+    }
+  }
+}
+#endif
+
+}  // namespace dicom
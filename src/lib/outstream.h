@@ -0,0 +1,98 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * outstream.h
+ */
+
+#ifndef DICOMSDL_OUTSTREAM_H__
+#define DICOMSDL_OUTSTREAM_H__
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "dicom.h"
+
+namespace dicom {  //-----------------------------------------------------------
+
+// OutStream::write_ref() copies values shorter than this.
+#define OUTSTREAM_COPY_SIZE  4096
+
+class InStream;
+
+// OutStream ---------------------------------------------------------------
+// Bytes of a DICOM file being saved. Short pieces such as tags and lengths
+// are copied into one growing buffer, long values are kept as pointers to
+// their memory and unchanged bytes of a source InStream are kept as ranges
+// of it. Lengths of sequences, items and groups are filled in the
+// buffer after their contents are written, so nothing is seeked and the
+// bytes are written to a sink in a few large writes; the sink may be a pipe
+// or a socket.
+// write_to() may throw exception.
+class OutStream {
+  struct Segment {
+    const uint8_t* ptr;  // memory of a long value; nullptr if in `buf_`
+    InStream* source;    // source stream of the bytes if not nullptr
+    size_t offset;       // offset in `buf_` or `source` if `ptr` is nullptr
+    size_t size;
+    size_t pos;          // position of the first byte in this OutStream
+  };
+
+  // return memory of `seg`; bytes from a source stream are loaded.
+  const uint8_t* segment_data(const Segment& seg) const;
+#ifndef _WIN32
+  // write segments [begin, end) with writev().
+  void _writev(int fd, size_t begin, size_t end) const;
+#endif
+
+  std::vector<uint8_t> buf_;
+  std::vector<Segment> segments_;
+  size_t size_;  // number of bytes written
+
+ public:
+  // 4 bytes length in `buf_` that counts bytes written after it.
+  struct LengthMarker {
+    size_t pos;     // position just after the length
+    size_t offset;  // offset of the length in `buf_`
+  };
+
+  OutStream();
+  OutStream(OutStream& other) = delete;
+  OutStream& operator=(OutStream&) = delete;
+
+  // copy `size` bytes.
+  void write(const void* data, size_t size);
+  // keep a pointer to `data` instead of copying it unless it is short.
+  // `data` should be valid until write_to() or str() returns.
+  void write_ref(const void* data, size_t size);
+  // keep bytes [offset, offset + size) of `source` as a range, which is
+  // joined with the last range if they are contiguous. Ranges of a file are
+  // copied by the kernel when written to a file descriptor on Linux.
+  void write_source(InStream* source, size_t offset, size_t size);
+
+  // return number of bytes written
+  inline size_t tell() const { return size_; }
+
+  // copy bytes [pos, pos + size) of the written bytes to `dst`; bytes from a
+  // source stream are loaded only for the range.
+  void copy_to(size_t pos, size_t size, void* dst) const;
+
+  // mark the last 4 bytes written by write() as a length, which is set by
+  // fill_length() to the number of bytes written in between.
+  LengthMarker mark_length() const;
+  void fill_length(const LengthMarker& marker, bool is_little_endian);
+
+  void clear();
+  void swap(OutStream& other);
+
+  // return all bytes as a string.
+  std::string str() const;
+  // write all bytes to `os` or to a file descriptor (with writev()).
+  void write_to(std::ostream& os) const;
+  void write_to(int fd) const;
+};
+
+}  // namespace dicom
+
+#endif  // DICOMSDL_OUTSTREAM_H__
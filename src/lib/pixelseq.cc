@@ -10,10 +10,12 @@
 
 #include <iostream>
 
+#include "arena.h"
 #include "dicom.h"
 #include "instream.h"
 #include "imagecodec.h"
 #include "codec_common.h"
+#include "threadpool.h"
 
 namespace dicom {
 
@@ -56,8 +58,8 @@ PixelSequence::~PixelSequence() {
 }
 
 PixelFrame* PixelSequence::addPixelFrame() {
-    frames_.push_back(
-          std::unique_ptr<PixelFrame>(new PixelFrame()));
+    frames_.push_back(arena_ptr<PixelFrame>(
+        root_dataset_->arena()->create<PixelFrame>()));
     return frames_.back().get();
 }
 
@@ -164,8 +166,10 @@ void PixelFrame::load(InStream *instream, size_t frame_length, uint8_t* buf) {
     if (remaining_bytes <= 0) break;
 
     // end of image or codestream marker?; end this frame.
-    uint8_t *frag_data = (uint8_t *)instream->get_pointer(frag_offset, length);
-    if (check_have_ffd9(frag_data, length) && (remaining_bytes < 8)) {
+    // check remaining_bytes first not to load the fragment's payload.
+    if (remaining_bytes < 8 &&
+        check_have_ffd9(
+            (uint8_t *)instream->get_pointer(frag_offset, length), length)) {
       puts("BREAK!!!");
       break;
       // 8 remaining_bytes may be for (fffe,e0dd)
@@ -377,6 +381,67 @@ void PixelSequence::setEncodedFrameData(size_t index, uint8_t *data,
   frames_[index].get()->setEncodedData(data, datasize);
 }
 
+// fill image information for decoding frames in `root_dataset`.
+static void init_imagecontainer(DataSet *root_dataset, imagecontainer *ic) {
+  ic->rows = root_dataset->getDataElement(0x00280010)->toLong();
+  ic->cols = root_dataset->getDataElement(0x00280011)->toLong();
+  ic->prec = root_dataset->getDataElement(0x00280100)->toLong();
+  ic->ncomps =
+      root_dataset->getDataElement(0x00280002)->toLong();  // SamplesPerPixel
+  ic->sgnd = root_dataset->getDataElement(0x00280103)
+                 ->toLong();  // PixelRepresentation
+  ic->lossy = 0;
+  ic->args[0] = '\0';
+  ic->info[0] = '\0';
+}
+
+void PixelSequence::encodeFrameData(size_t index, uint8_t *data,
+                                    size_t datasize, int rowstep,
+                                    const char *args) {
+  if (index >= frames_.size())
+    LOGERROR_AND_THROW(
+        "PixelSequence::encodeFrameData - index '%d' is out of "
+        "range(0..%d)",
+        index, (long)frames_.size() - 1);
+  if (!data)
+    LOGERROR_AND_THROW(
+        "PixelSequence::encodeFrameData - data for image to be encoded is "
+        "null.");
+
+  imagecontainer ic;
+  init_imagecontainer(root_dataset_, &ic);
+  ic.rowstep = rowstep;
+  ic.datasize = (long)datasize;
+  ic.data = (char *)data;
+  if (args) {
+    strncpy(ic.args, args, ARGBUF_SIZE - 1);
+    ic.args[ARGBUF_SIZE - 1] = '\0';
+  }
+
+  char *encdata = nullptr;
+  long encsize = 0;
+  free_memory_fnptr free_memory_fn = nullptr;
+  DICOMSDL_CODEC_RESULT codec_result =
+      encode_pixeldata(UID::to_uidvalue(transfer_syntax_), &ic, &encdata,
+                       &encsize, &free_memory_fn);
+  if (codec_result == DICOMSDL_CODEC_ERROR) {
+    if (encdata && free_memory_fn) free_memory_fn(encdata);
+    LOGERROR_AND_THROW(
+        "PixelSequence::encodeFrameData - error in encoding frame data "
+        "'%s'",
+        ic.info);
+  } else if (codec_result == DICOMSDL_CODEC_WARN)
+    LOG_WARN("%s", ic.info);
+
+  try {
+    frames_[index].get()->setEncodedData((uint8_t *)encdata, (size_t)encsize);
+  } catch (...) {
+    free_memory_fn(encdata);
+    throw;
+  }
+  free_memory_fn(encdata);
+}
+
 void PixelSequence::copyDecodedFrameData(size_t index, uint8_t *data,
                                          int datasize, int rowstep) {
   if (index >= frames_.size())
@@ -390,15 +455,7 @@ void PixelSequence::copyDecodedFrameData(size_t index, uint8_t *data,
 
   // start decompress
   imagecontainer ic;
-
-  ic.rows = root_dataset_->getDataElement(0x00280010)->toLong();
-  ic.cols = root_dataset_->getDataElement(0x00280011)->toLong();
-  ic.prec = root_dataset_->getDataElement(0x00280100)->toLong();
-  ic.ncomps =
-      root_dataset_->getDataElement(0x00280002)->toLong();  // SamplesPerPixel
-  ic.sgnd = root_dataset_->getDataElement(0x00280103)
-                ->toLong();  // PixelRepresentation
-  ic.lossy = 0;
+  init_imagecontainer(root_dataset_, &ic);
 
   ic.rowstep = rowstep;
   if (!data) {
@@ -431,4 +488,65 @@ void PixelSequence::copyDecodedFrameData(size_t index, uint8_t *data,
   // check lossy and check DataElement in DataSet...
 }
 
+void PixelSequence::decodeFrames(size_t start, size_t count, uint8_t *data,
+                                 size_t datasize, int rowstep, int nthreads,
+                                 std::vector<std::string> *errors) {
+  if (start > frames_.size() || count > frames_.size() - start)
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - frames '%d..%d' are out of "
+        "range(0..%d)",
+        start, (long)(start + count) - 1, (long)frames_.size() - 1);
+
+  if (!data) {
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - data for decoded image is null.");
+  }
+
+  imagecontainer ic;
+  init_imagecontainer(root_dataset_, &ic);
+  ic.rowstep = rowstep;
+  ic.datasize = ic.rows * ic.rowstep;
+
+  if ((size_t)ic.datasize * count != datasize) {
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - datasize '%d' is not suitable "
+        "for decoded data (%d bytes is required)",
+        datasize, (size_t)ic.datasize * count);
+  }
+
+  // Read encoded data of all frames here; the stream is not touched by
+  // decoding threads.
+  std::vector<Buffer<uint8_t>> encdata;
+  encdata.reserve(count);
+  for (size_t i = 0; i < count; i++)
+    encdata.push_back(encodedFrameData(start + i));
+
+  const char *tsuid = UID::to_uidvalue(root_dataset_->getTransferSyntax());
+  std::vector<std::string> messages(count);
+
+  parallel_for(count, nthreads, [&](size_t i) {
+    imagecontainer fic = ic;
+    fic.data = (char *)data + (size_t)ic.datasize * i;
+
+    DICOMSDL_CODEC_RESULT codec_result = decode_pixeldata(
+        tsuid, (char *)encdata[i].data, encdata[i].size, &fic);
+    if (codec_result == DICOMSDL_CODEC_ERROR)
+      messages[i] = fic.info[0] ? fic.info : "error in decoding frame data";
+    else if (codec_result == DICOMSDL_CODEC_WARN)
+      LOG_WARN("%s", fic.info);
+  });
+
+  if (errors) {
+    *errors = std::move(messages);
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    if (!messages[i].empty())
+      LOGERROR_AND_THROW(
+          "PixelSequence::decodeFrames - error in decoding frame %d '%s'",
+          start + i, messages[i].c_str());
+  }
+}
+
 }  // namespace dicom
\ No newline at end of file
@@ -9,122 +9,219 @@
 #include "rle_codec.h"
 
 #include <stdio.h>
+#include <string.h>
+
+#include <vector>
 
 #include "codec_common.h"
 #include "dicom.h"
+#include "threadpool.h"
+#include "util.h"
 
 namespace dicom {  //------------------------------------------------------
 
 
-static long decode_rle_segment(Buffer<uint8_t>& encdata, Buffer<uint8_t>& decdata) {
-  uint8_t *p = encdata.data;
-  uint8_t *p_end = p + encdata.size;
-  uint8_t *q = decdata.data;
-  uint8_t *q_end = q + decdata.size;
-  size_t decoded_bytes = 0;
-
-  uint8_t c;
-  int i;
-  while (p < p_end - 1) {
-    c = *p++;
-    if (c > 0x80) {
-      for (i = 0; i < (0x101 - c); i++)
-        *q++ = *p;
-      p++;
-    } else if (c < 0x80) {
-      for (i = 0; i < (c + 1); i++)
-        *q++ = *p++;
-    } else {
-      return -1; // error
+// bytes of a sample in a decoded image.
+static int bytes_per_sample(int prec) {
+  return (prec > 16 ? 4 : (prec > 8 ? 2 : 1));
+}
+
+// Destination of bytes decoded from a segment. Bytes go to every `stride`
+// bytes from `row`, and to the next row after `cols` bytes; e.g. byte plane
+// k of 16 bits samples or component k of RGB pixels.
+struct rle_plane {
+  uint8_t *row;   // first byte of the plane in the current row
+  int offset;     // offset of the plane in a sample
+  int stride;     // bytes between samples
+  int rowstep;
+  int cols;
+  int col;        // column in the current row
+  int rows_left;  // number of rows to be filled including the current row
+
+#ifdef UTIL_X86_SIMD
+  // pshufb masks which spread 16 bytes to 16 samples in `stride` vectors,
+  // and masks of the plane's bytes in the vectors.
+  uint8_t shuffle[4][16];
+  uint8_t blend[4][16];
+#endif
+};
+
+static void init_rle_plane(rle_plane *d, uint8_t *row, int offset, int stride,
+                           int rowstep, int rows, int cols) {
+  d->row = row + offset;
+  d->offset = offset;
+  d->stride = stride;
+  d->rowstep = rowstep;
+  d->cols = cols;
+  d->col = 0;
+  d->rows_left = rows;
+#ifdef UTIL_X86_SIMD
+  for (int i = 0; i < 4 * 16 && stride <= 4; i++) {
+    bool mine = (i % stride == offset % stride);
+    d->shuffle[i / 16][i % 16] = (mine ? (uint8_t)(i / stride) : 0x80);
+    d->blend[i / 16][i % 16] = (mine ? 0xff : 0x00);
+  }
+#endif
+}
+
+#ifdef UTIL_X86_SIMD
+// Write 16 samples at a time of `n` samples at `base` of the current row
+// with masks of `d`; stride of `d` should be 2..4. Bytes of the other planes
+// are loaded and stored back as they are. Return number of samples written.
+UTIL_TARGET("ssse3")
+static int _fill_plane_ssse3(const rle_plane &d, uint8_t *base, uint8_t c,
+                             int n) {
+  __m128i v = _mm_set1_epi8((char)c);
+  int i = 0;
+  for (; i + 16 <= n; i += 16, base += 16 * d.stride) {
+    for (int k = 0; k < d.stride; k++) {
+      __m128i m = _mm_loadu_si128((const __m128i *)d.blend[k]);
+      __m128i x = _mm_loadu_si128((const __m128i *)(base + 16 * k));
+      x = _mm_or_si128(_mm_andnot_si128(m, x), _mm_and_si128(m, v));
+      _mm_storeu_si128((__m128i *)(base + 16 * k), x);
     }
   }
-  return q - decdata.data;
+  return i;
 }
 
-static DICOMSDL_CODEC_RESULT decode_rle(char *src, long srclen,
-                                        imagecontainer *ic) {
-  uint32_t *header;
-  header = (uint32_t *) src;
-  int nsegments = int(header[0]);
-  DICOMSDL_CODEC_RESULT result;
-
-  // prepare buffer for decoded pixels
-  int decdata_size = ic->rows * ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps;
-  Buffer<uint8_t> decdata(decdata_size);
-
-  // process each segments
-  uint8_t *q =  decdata.data;
-  size_t remaining = decdata.size;
-  for (int i = 1; i <= nsegments; i++) {
-    size_t startoffset, endoffset;
-    startoffset = header[i];
-    if (i == nsegments)
-      endoffset = srclen;
+UTIL_TARGET("ssse3")
+static int _copy_plane_ssse3(const rle_plane &d, uint8_t *base,
+                             const uint8_t *src, int n) {
+  int i = 0;
+  for (; i + 16 <= n; i += 16, src += 16, base += 16 * d.stride) {
+    __m128i v = _mm_loadu_si128((const __m128i *)src);
+    for (int k = 0; k < d.stride; k++) {
+      __m128i m = _mm_loadu_si128((const __m128i *)d.blend[k]);
+      __m128i s = _mm_shuffle_epi8(
+          v, _mm_loadu_si128((const __m128i *)d.shuffle[k]));
+      __m128i x = _mm_loadu_si128((const __m128i *)(base + 16 * k));
+      x = _mm_or_si128(_mm_andnot_si128(m, x), s);
+      _mm_storeu_si128((__m128i *)(base + 16 * k), x);
+    }
+  }
+  return i;
+}
+
+static const bool use_ssse3 = cpu_has_ssse3();
+#endif
+
+// Write `n` bytes of `c` (if `src` is nullptr) or `src` to the plane in the
+// current row; `n` should not exceed the rest of the row.
+static void write_plane_row(rle_plane &d, uint8_t c, const uint8_t *src,
+                            int n) {
+  uint8_t *q = d.row + d.col * d.stride;
+  d.col += n;
+
+  if (d.stride == 1) {
+    if (src)
+      memcpy(q, src, n);
     else
-      endoffset = header[i + 1];
+      memset(q, c, n);
+    return;
+  }
 
-    Buffer<uint8_t> enc_segment((uint8_t *)src + startoffset,
-                                endoffset - startoffset);
-    Buffer<uint8_t> dec_segment(q, remaining);
+  int i = 0;
+#ifdef UTIL_X86_SIMD
+  if (n >= 16 && d.stride <= 4 && use_ssse3) {
+    uint8_t *base = q - d.offset;  // first byte of the sample
+    i = (src ? _copy_plane_ssse3(d, base, src, n)
+             : _fill_plane_ssse3(d, base, c, n));
+    q += i * d.stride;
+  }
+#endif
+  if (src) {
+    for (src += i; i < n; i++, q += d.stride) *q = *src++;
+  } else {
+    for (; i < n; i++, q += d.stride) *q = c;
+  }
+}
 
-    long ndecoded = decode_rle_segment(enc_segment, dec_segment);
-    if (ndecoded < 0)
-      break; // error
-    remaining -= (size_t)ndecoded;
-    q += ndecoded;
+static void write_plane(rle_plane &d, uint8_t c, const uint8_t *src, int n) {
+  while (n > 0 && d.rows_left > 0) {
+    int m = d.cols - d.col;
+    if (m > n) m = n;
+    write_plane_row(d, c, src, m);
+    if (src) src += m;
+    n -= m;
+    if (d.col == d.cols) {
+      d.row += d.rowstep;
+      d.col = 0;
+      d.rows_left--;
+    }
+  }
+}
+
+// Decode a PackBits segment into `d`; bytes after the plane is filled are
+// ignored. Return false if the segment is broken.
+static bool decode_rle_segment(const uint8_t *p, const uint8_t *p_end,
+                               rle_plane &d) {
+  while (p < p_end - 1 && d.rows_left > 0) {
+    uint8_t c = *p++;
+    if (c > 0x80) {  // replicate run
+      write_plane(d, *p++, nullptr, 0x101 - c);
+    } else if (c < 0x80) {  // literal run
+      int n = c + 1;
+      if (n > p_end - p) return false;
+      write_plane(d, 0, p, n);
+      p += n;
+    } else {
+      return false;
+    }
   }
+  return true;
+}
+
+static DICOMSDL_CODEC_RESULT decode_rle(char *src, long srclen,
+                                        imagecontainer *ic) {
+  uint8_t *header = (uint8_t *)src;
+  int nsegments = (int)load_le<uint32_t>(header);
+  int bps = bytes_per_sample(ic->prec);
 
-  if (remaining > 0) {
+  if (nsegments != ic->ncomps * bps || nsegments > 15) {
     snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
-             "out buffer is not filled by %d bytes.",
-             int(remaining));
-    result = DICOMSDL_CODEC_ERROR;
-    goto DECODE_END;
-  }
-
-  // change planar configuration color-by-plane to color-by-pixel
-  {
-    int nplanes;
-    if (ic->prec > 8 && ic->ncomps == 1)
-      nplanes = 2;
-    else if (ic->prec == 8)
-      nplanes = ic->ncomps;
-    else {
+             "unsupported image format - %d bits, %d planes and %d segments.",
+             ic->prec, ic->ncomps, nsegments);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  uint8_t *first_row = (uint8_t *)ic->data;
+  if (ic->rowstep < 0)
+    first_row += -(ic->rowstep) * (ic->rows - 1);
+
+  // decode each segment straight into its byte of samples; the first
+  // segment of a sample is the most significant byte.
+  for (int i = 0; i < nsegments; i++) {
+    size_t startoffset = load_le<uint32_t>(header + 4 * (i + 1));
+    size_t endoffset = (i + 1 == nsegments
+                            ? (size_t)srclen
+                            : load_le<uint32_t>(header + 4 * (i + 2)));
+    if (startoffset < 64 || startoffset > endoffset ||
+        endoffset > (size_t)srclen) {
+      snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
+               "segment %d has invalid offsets (%d..%d).",
+               i, int(startoffset), int(endoffset));
+      return DICOMSDL_CODEC_ERROR;
+    }
+
+    int comp = i / bps, byte = i % bps;
+    rle_plane d;
+    init_rle_plane(&d, first_row, comp * bps + (bps - 1 - byte),
+                   ic->ncomps * bps, ic->rowstep, ic->rows, ic->cols);
+    if (!decode_rle_segment(header + startoffset, header + endoffset, d)) {
       snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
-               "unsupported image format - %d bits and %d planes.",
-               ic->prec, ic->ncomps);
+               "segment %d is broken.", i);
       return DICOMSDL_CODEC_ERROR;
-      goto DECODE_END;
     }
-    { // copy
-      int msb_first = (ic->prec > 8 ? 0 : 1);
-      uint8_t *p, *q;
-      int plane_strides = ic->rows * ic->cols;
-      for (int k = 0; k < nplanes; k++) {
-        p = decdata.data + plane_strides * k;
-        q = (uint8_t *) (ic->data);
-        if (ic->rowstep < 0)
-          q += -(ic->rowstep) * (ic->rows - 1);
-        if (msb_first)
-          q += k;
-        else
-          q += nplanes - k - 1;
-
-        for (int j = 0; j < ic->rows; j++) {
-          for (int i = 0; i < ic->cols; i++) {
-            q[i * nplanes] = p[i];
-          }
-          p += ic->cols;
-          q += ic->rowstep;
-        }
-      }
+    if (d.rows_left > 0) {
+      snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
+               "out buffer is not filled by %d bytes in segment %d.",
+               int((d.rows_left * ic->cols - d.col)), i);
+      return DICOMSDL_CODEC_ERROR;
     }
   }
-  result = DICOMSDL_CODEC_OK;
- DECODE_END:
-  //  decdata.free(); // `~Buffer` will free allocated data.
-   return result;
- }
+
+  return DICOMSDL_CODEC_OK;
+}
 
 extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
                                              long datasize,
@@ -141,16 +238,16 @@ extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
   }
 
   if (ic->datasize < ic->rowstep * ic->rows
-      || ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
+      || ic->rowstep < ic->cols * bytes_per_sample(ic->prec) * ic->ncomps) {
     snprintf(ic->info, ARGBUF_SIZE, "pixelbuf for decoded image is too small; "
              "buflen %d < rowstep %d * rows %d or "
-             "rowstep < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
+             "rowstep < cols %d * bytes of prec %d * ncomps %d",
              int(ic->datasize), ic->rowstep, ic->rows, ic->cols, ic->prec,
              ic->ncomps);
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (datasize < 64 + 2 + 2) {
+  if (datasize < 64 + 2) {  // header and a segment of one run
     snprintf(ic->info, ARGBUF_SIZE, "datasize (%d) is too small.",
              int(datasize));
     return DICOMSDL_CODEC_ERROR;
@@ -159,6 +256,126 @@ extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
   return decode_rle(data, datasize, ic);
 }
 
+// Append PackBits of `n` bytes in `p` to `q`; return the end of the output.
+// At most n + (n + 127) / 128 bytes are written.
+static uint8_t *encode_rle_row(const uint8_t *p, int n, uint8_t *q) {
+  int i = 0;
+  while (i < n) {
+    int j = i + 1;
+    while (j < n && j - i < 128 && p[j] == p[i]) j++;
+    if (j - i >= 2) {  // replicate run
+      *q++ = (uint8_t)(0x101 - (j - i));
+      *q++ = p[i];
+      i = j;
+      continue;
+    }
+
+    // literal run until 3 same bytes, which are cheaper as a replicate run.
+    j = i + 1;
+    while (j < n && j - i < 128 &&
+           !(j + 2 < n && p[j] == p[j + 1] && p[j] == p[j + 2]))
+      j++;
+    *q++ = (uint8_t)(j - i - 1);
+    memcpy(q, p + i, j - i);
+    q += j - i;
+    i = j;
+  }
+  return q;
+}
+
+// Encode a byte plane of an image; bytes of the plane are at every `stride`
+// bytes from `row` and rows are `rowstep` bytes apart. Each row is encoded
+// separately (PS3.5 G.3.1) and the segment is padded to even length.
+static void encode_rle_segment(const uint8_t *row, int stride, int rowstep,
+                               int rows, int cols,
+                               std::vector<uint8_t> &out) {
+  out.resize((size_t)rows * (cols + (cols + 127) / 128) + 1);
+  std::vector<uint8_t> line(stride == 1 ? 0 : cols);
+  uint8_t *q = out.data();
+
+  for (int r = 0; r < rows; r++, row += rowstep) {
+    const uint8_t *p = row;
+    if (stride != 1) {
+      for (int c = 0; c < cols; c++) line[c] = row[c * stride];
+      p = line.data();
+    }
+    q = encode_rle_row(p, cols, q);
+  }
+
+  size_t size = q - out.data();
+  if (size & 1) out[size++] = 0;
+  out.resize(size);
+}
+
+// Frames with fewer samples are encoded in one thread.
+#define RLE_PARALLEL_MIN_SAMPLES  (1 << 16)
+
+static DICOMSDL_CODEC_RESULT encode_rle(imagecontainer *ic, int planar,
+                                        char **data, long *datasize) {
+  int bps = bytes_per_sample(ic->prec);
+  int nsegments = ic->ncomps * bps;
+  if (nsegments > 15) {
+    snprintf(ic->info, ARGBUF_SIZE, "encode_rle(...): "
+             "unsupported image format - %d bits and %d planes.",
+             ic->prec, ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // first row of the image or of the first component if `planar`.
+  uint8_t *first_row = (uint8_t *)ic->data;
+  int abs_rowstep = (ic->rowstep < 0 ? -ic->rowstep : ic->rowstep);
+  if (ic->rowstep < 0)
+    first_row += abs_rowstep * (ic->rows - 1);
+  size_t planestep = (size_t)abs_rowstep * ic->rows;
+
+  // segments are for components in order, and the most significant byte
+  // first in each component.
+  std::vector<std::vector<uint8_t>> segments(nsegments);
+  auto encode_segment = [&](size_t i) {
+    int comp = (int)i / bps, byte = (int)i % bps;
+    int offset = bps - 1 - byte;
+    if (planar)
+      encode_rle_segment(first_row + planestep * comp + offset, bps,
+                         ic->rowstep, ic->rows, ic->cols, segments[i]);
+    else
+      encode_rle_segment(first_row + comp * bps + offset, ic->ncomps * bps,
+                         ic->rowstep, ic->rows, ic->cols, segments[i]);
+  };
+
+  int nthreads = 1;
+  if ((long)ic->rows * ic->cols >= RLE_PARALLEL_MIN_SAMPLES)
+    nthreads = get_num_threads((int)Config::getInteger("RLE_THREADS", 0));
+  try {
+    parallel_for(nsegments, nthreads, encode_segment);
+  } catch (std::exception &e) {
+    snprintf(ic->info, ARGBUF_SIZE, "encode_rle(...): %s", e.what());
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // header of 16 numbers; number of segments and offsets of segments.
+  size_t size = 64;
+  for (auto &seg : segments) size += seg.size();
+  uint8_t *buf = (uint8_t *)::malloc(size);
+  if (!buf) {
+    snprintf(ic->info, ARGBUF_SIZE, "encode_rle(...): "
+             "cannot allocate %d bytes.", int(size));
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  memset(buf, 0, 64);
+  store_le<uint32_t>(buf, (uint32_t)nsegments);
+  size_t offset = 64;
+  for (int i = 0; i < nsegments; i++) {
+    store_le<uint32_t>(buf + 4 * (i + 1), (uint32_t)offset);
+    memcpy(buf + offset, segments[i].data(), segments[i].size());
+    offset += segments[i].size();
+  }
+
+  *data = (char *)buf;
+  *datasize = (long)size;
+  return DICOMSDL_CODEC_OK;
+}
+
 extern "C" DICOMSDL_CODEC_RESULT rle_encoder(
     const char *tsuid, imagecontainer *ic, char **data, long *datasize,
     free_memory_fnptr *free_memory_fn) {
@@ -168,9 +385,9 @@ extern "C" DICOMSDL_CODEC_RESULT rle_encoder(
       )
     return DICOMSDL_CODEC_NOTSUPPORTED;
 
-  if (!*data || datasize || *free_memory_fn) {
+  if (!data || !datasize || !free_memory_fn) {
     snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
-             "*data or datasize or *free_memory_fn is NULL.");
+             "data or datasize or free_memory_fn is NULL.");
     return DICOMSDL_CODEC_ERROR;
   }
 
@@ -178,9 +395,40 @@ extern "C" DICOMSDL_CODEC_RESULT rle_encoder(
   *datasize = 0;
   *free_memory_fn = rle_codec_free_memory;
 
-  snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
-           "not implemented yet.");
-  return DICOMSDL_CODEC_ERROR;
+  // planar=1 if components are stored in planes RRR..GGG..BBB..; each plane
+  // is rows * rowstep bytes.
+  int planar = 0;
+  argparser p(ic);
+  int key;
+  while ((key = p.get_next_argkey()) > 0) {
+    switch (key) {
+      case ARGKEY_PLANAR:
+        planar = (p.value_as_int() != 0);
+        break;
+      default:
+        break;
+    }
+  }
+  if (key != 0)  // argument key error, error message in ic->info
+    return DICOMSDL_CODEC_ERROR;
+
+  int bps = bytes_per_sample(ic->prec);
+  int nplanes = (planar ? ic->ncomps : 1);
+  long rowbytes = (long)ic->cols * bps * (planar ? 1 : ic->ncomps);
+  if (!ic->data || ic->rows <= 0 || ic->cols <= 0 || ic->ncomps <= 0 ||
+      (ic->rowstep < 0 ? -ic->rowstep : ic->rowstep) < rowbytes ||
+      ic->datasize < (long)(ic->rowstep < 0 ? -ic->rowstep : ic->rowstep) *
+                         ic->rows * nplanes) {
+    snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
+             "pixelbuf is too small or image is empty; "
+             "buflen %d, rowstep %d, rows %d, cols %d, prec %d, ncomps %d",
+             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, ic->prec,
+             ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  ic->lossy = 0;
+  return encode_rle(ic, planar, data, datasize);
 }
 
 extern "C" void rle_codec_free_memory(char *data) {
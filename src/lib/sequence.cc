@@ -8,12 +8,18 @@
 
 #include <iostream>
 
+#include "arena.h"
 #include "dicom.h"
 #include "instream.h"
 
 namespace dicom {
 
-Sequence::Sequence(DataSet *root_dataset): root_dataset_(root_dataset)
+Sequence::Sequence(DataSet *root_dataset)
+    : root_dataset_(root_dataset),
+      instream_(nullptr),
+      offset_(0),
+      length_(0),
+      loaded_(true)
 {
   LOG_DEBUG("++ @%p\tSequence::Sequence(DataSet *)", this);
 
@@ -25,12 +31,19 @@ Sequence::~Sequence()
   LOG_DEBUG("-- @%p\tSequence::~Sequence()", this);
 }
 
-DataSet* Sequence::addDataSet()
+DataSet* Sequence::_add_dataset()
 {
-  seq_.push_back(std::unique_ptr<DataSet>(new DataSet(root_dataset_)));
+  seq_.push_back(arena_ptr<DataSet>(
+      root_dataset_->arena()->create<DataSet>(root_dataset_)));
   return seq_.back().get();
 }
 
+DataSet* Sequence::addDataSet()
+{
+  _ensure_loaded();
+  return _add_dataset();
+}
+
 DataSet* Sequence::getDataSet(size_t index) {
   if (index < size())
     return seq_[index].get();
@@ -45,6 +58,47 @@ DataSet* Sequence::operator[](size_t index) {
     return nullptr;
 }
 
+void Sequence::setDeferredLoad(InStream *instream, size_t offset,
+                               size_t length) {
+  instream_ = instream;
+  offset_ = offset;
+  length_ = length;
+  loaded_.store(false, std::memory_order_release);
+}
+
+void Sequence::_load_items() {
+  // `root_dataset_` is the DataSet which contains this Sequence; items are
+  // built in the Arena of the root DataSet at the top, under its load lock.
+  DataSet *root = root_dataset_;
+  while (root->root_dataset_ != root)
+    root = root->root_dataset_;
+  std::lock_guard<std::recursive_mutex> lock(root->load_mutex_);
+
+  if (loaded_.load(std::memory_order_relaxed)) {
+    // another thread has parsed items, or parsing them has failed.
+    if (!load_error_.empty()) throw DicomException(load_error_.c_str());
+    return;
+  }
+
+  LOG_DEBUG("   @%p\tSequence::_load_items() %d bytes at {%#x}", this,
+            length_, offset_);
+
+  try {
+    InSubStream subs(instream_, offset_, length_);
+    load(&subs);
+  } catch (std::exception &e) {
+    // don't parse again; later calls throw the same error rather than
+    // returning items parsed so far.
+    load_error_ = e.what();
+    if (load_error_.empty()) load_error_ = "Sequence::load - failed";
+    instream_ = nullptr;
+    loaded_.store(true, std::memory_order_release);
+    throw;
+  }
+  instream_ = nullptr;
+  loaded_.store(true, std::memory_order_release);
+}
+
 void Sequence::load(InStream *instream) {
   uint8_t buf[8];
   size_t n;
@@ -87,7 +141,7 @@ void Sequence::load(InStream *instream) {
 
     if (length == 0xffffffff) length = instream->bytes_remaining();
 
-    DataSet* dataset = addDataSet();
+    DataSet* dataset = _add_dataset();
     if (length) {
       dataset->attachToInstream(instream, length);
       dataset->setOffset(offset);
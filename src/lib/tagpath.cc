@@ -0,0 +1,246 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * tagpath.cc
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dicom.h"
+
+namespace dicom {
+
+TagPath::Step::Step(tag_t tag, const std::string& creator)
+    : tag(tag), creator(creator), index(TagPath::LAST), block(0) {}
+
+TagPath::Step::Step(const Step& other)
+    : tag(other.tag),
+      creator(other.creator),
+      index(other.index),
+      block(other.block.load(std::memory_order_relaxed)) {}
+
+TagPath::TagPath(const char* tagstr) : tagstr_(tagstr) {
+  const char *_tagstr = tagstr;
+  char *nextptr;
+  const char *endptr = tagstr + strlen(tagstr);
+
+  tag_t tag, gggg, eeee;
+
+  while (1) {
+    std::string creator;
+
+    // ignore starting (
+    if (_tagstr[0] == '(')
+      _tagstr++;
+
+    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
+        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
+         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
+      // string starts with number - read gggg or ggggeeee
+      tag = tag_t(strtol(_tagstr, &nextptr, 16));
+
+      if (nextptr && (*nextptr == ',' || *nextptr == '{')) {
+        // if string->hex conversion is stopped by ',' or '{',
+        // first portion is group number
+        gggg = tag;
+
+        // if ",{" string sequence, skip ','
+        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
+
+        // string between { and } is creator id
+        // e.g. 0000,{CREATOR}00
+        if ((*nextptr == '{') && (tag & 1)) {
+          nextptr++;
+          int n = 0;
+          while (nextptr[n] && nextptr[n] != '}') n++;
+
+          if (nextptr[n] == '\0')
+            LOGERROR_AND_THROW(
+                "TagPath::TagPath(\"%s\"): "
+                "malformed string -- no matching '}'",
+                tagstr);
+          creator.assign(nextptr, n);
+
+          _tagstr = nextptr + n + 1;
+
+          // Get element number in the block; block is found in find().
+          eeee = tag_t(strtol(_tagstr, &nextptr, 16)) & 0xff;
+        } else {
+          _tagstr = nextptr + 1;
+
+          // Get element number in eeee form
+          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
+        }
+
+        if (eeee == 0 && _tagstr == nextptr)
+          LOGERROR_AND_THROW(
+              "TagPath::TagPath - "
+              "malformed string '%s'; no number after ',' or '}'",
+              tagstr);
+
+        tag = TAG::build(gggg, eeee);
+
+        if (*nextptr == ')') nextptr++;
+      }
+    } else {
+      // tagstr is keyword string
+      int n = 0;
+
+      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
+        n++;
+      tag = TAG::from_keyword(_tagstr, n);
+      if (tag == 0xffffffff)
+        LOGERROR_AND_THROW(
+            "TagPath::TagPath - error in string '%s'; no such keyword "
+            "'%s'",
+            tagstr, std::string(_tagstr, n).c_str());
+
+      nextptr = (char *) _tagstr + n;
+    }
+
+    steps_.emplace_back(tag, creator);
+
+    _tagstr = nextptr + 1;
+    if (_tagstr >= endptr)
+      break;
+
+    // number after '.' is DataSet sequence number, starting from 0;
+    // '*' for all items.
+    if (_tagstr[0] == '*') {
+      steps_.back().index = ANY;
+      nextptr = (char *) _tagstr + 1;
+    } else {
+      long seqidx = strtol(_tagstr, &nextptr, 10);
+      steps_.back().index =
+          (seqidx < 0 || seqidx > INT_MAX) ? INT_MAX : int(seqidx);
+    }
+
+    // a path ending with a sequence number keeps the index in the last step;
+    // find() gives NullElement for it.
+    _tagstr = nextptr + 1;
+    if (_tagstr >= endptr)
+      break;
+  }
+}
+
+tag_t TagPath::_resolve(const Step& step, DataSet* dataset) const {
+  if (step.creator.empty())
+    return step.tag;
+
+  tag_t gggg = TAG::group(step.tag);
+  tag_t ee = TAG::element(step.tag);
+
+  // try the block found last time
+  tag_t block = step.block.load(std::memory_order_relaxed);
+  if (block >= 0x10) {
+    DataElement* creator_de = dataset->getDataElement(TAG::build(gggg, block));
+    if (creator_de->isValid() && creator_de->toBytes() == step.creator)
+      return TAG::build(gggg, (block << 8) + ee);
+  }
+
+  // find element from gggg0010 to gggg00ff
+  for (block = 0x10; block <= 0xff; block++) {
+    DataElement* creator_de = dataset->getDataElement(TAG::build(gggg, block));
+    if (!creator_de->isValid()) continue;
+    if (creator_de->toBytes() == step.creator) {
+      step.block.store((uint8_t)block, std::memory_order_relaxed);
+      return TAG::build(gggg, (block << 8) + ee);
+    }
+  }
+
+  // no such block of elements from private creator
+  return 0xffffffff;
+}
+
+DataElement* TagPath::find(DataSet* dataset) const {
+  DataElement* el = DataElement::NullElement();
+
+  for (size_t i = 0; i < steps_.size(); i++) {
+    const Step& step = steps_[i];
+
+    tag_t tag = _resolve(step, dataset);
+    if (tag == 0xffffffff)
+      return DataElement::NullElement();
+
+    el = dataset->getDataElement(tag);
+    if (!el->isValid() || step.index == LAST)
+      return el;
+
+    if (el->vr() != VR::SQ)
+      LOGERROR_AND_THROW(
+          "TagPath::find - error in string '%s'; VR of element %s "
+          "(VR::%s) is not VR::SQ",
+          tagstr_.c_str(), TAG::repr(tag).c_str(), VR::repr(el->vr()));
+
+    int index = (step.index == ANY ? 0 : step.index);
+    dataset = el->toSequence()->getDataSet(index);
+    if (dataset == NULL || i + 1 == steps_.size()) {
+      // no DataSet with index in the Sequence
+      return DataElement::NullElement();
+    }
+  }
+  return el;
+}
+
+void TagPath::_forEach(size_t i, DataSet* dataset,
+                       const std::function<void(DataElement*)>& fn) const {
+  for (; i < steps_.size(); i++) {
+    const Step& step = steps_[i];
+
+    tag_t tag = _resolve(step, dataset);
+    if (tag == 0xffffffff)
+      return fn(DataElement::NullElement());
+
+    DataElement* el = dataset->getDataElement(tag);
+    if (!el->isValid() || step.index == LAST)
+      return fn(el);
+
+    if (el->vr() != VR::SQ)
+      LOGERROR_AND_THROW(
+          "TagPath::forEach - error in string '%s'; VR of element %s "
+          "(VR::%s) is not VR::SQ",
+          tagstr_.c_str(), TAG::repr(tag).c_str(), VR::repr(el->vr()));
+    if (i + 1 == steps_.size())
+      return fn(DataElement::NullElement());
+
+    Sequence* seq = el->toSequence();
+    if (step.index == ANY) {
+      int n = seq->size();
+      for (int k = 0; k < n; k++)
+        _forEach(i + 1, seq->getDataSet(k), fn);
+      return;
+    }
+    dataset = seq->getDataSet(step.index);
+    if (dataset == NULL)
+      return fn(DataElement::NullElement());
+  }
+}
+
+void TagPath::forEach(DataSet* dataset,
+                      const std::function<void(DataElement*)>& fn) const {
+  _forEach(0, dataset, fn);
+}
+
+void TagPath::toDoubleVector(DataSet* dataset, std::vector<double>& values,
+                             double default_value) const {
+  forEach(dataset, [&values, default_value](DataElement* el) {
+    values.push_back(el->isValid() && el->length() > 0
+                         ? el->toDouble(default_value)
+                         : default_value);
+  });
+}
+
+void TagPath::toLongVector(DataSet* dataset, std::vector<long>& values,
+                           long default_value) const {
+  forEach(dataset, [&values, default_value](DataElement* el) {
+    values.push_back(el->isValid() && el->length() > 0
+                         ? el->toLong(default_value)
+                         : default_value);
+  });
+}
+
+}  // namespace dicom
@@ -0,0 +1,129 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * threadpool.cc
+ */
+
+#include "threadpool.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dicom {
+
+namespace {
+
+// indices [begin, end) to be processed by a thread.
+struct WorkQueue {
+  std::mutex mutex;
+  size_t begin;
+  size_t end;
+
+  bool pop(size_t& index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (begin == end) return false;
+    index = begin++;
+    return true;
+  }
+
+  size_t remaining() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return end - begin;
+  }
+};
+
+}  // namespace
+
+int get_num_threads(int nthreads) {
+  if (nthreads > 0) return nthreads;
+  int ncores = (int)std::thread::hardware_concurrency();
+  return ncores > 0 ? ncores : 1;
+}
+
+void parallel_for(size_t n, int nthreads,
+                  const std::function<void(size_t)>& fn) {
+  if (n == 0) return;
+
+  nthreads = get_num_threads(nthreads);
+  if ((size_t)nthreads > n) nthreads = (int)n;
+
+  if (nthreads == 1) {
+    for (size_t i = 0; i < n; i++) fn(i);
+    return;
+  }
+
+  std::unique_ptr<WorkQueue[]> queues(new WorkQueue[nthreads]);
+  for (int t = 0; t < nthreads; t++) {
+    queues[t].begin = n * t / nthreads;
+    queues[t].end = n * (t + 1) / nthreads;
+  }
+
+  std::atomic<bool> failed(false);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  // steal half of the indices from the back of the busiest queue into
+  // `queues[self]`.
+  auto steal = [&](int self) -> bool {
+    while (true) {
+      int victim = -1;
+      size_t most = 0;
+      for (int t = 0; t < nthreads; t++) {
+        if (t == self) continue;
+        size_t r = queues[t].remaining();
+        if (r > most) {
+          most = r;
+          victim = t;
+        }
+      }
+      if (victim < 0) return false;
+
+      size_t begin, end;
+      {
+        std::lock_guard<std::mutex> lock(queues[victim].mutex);
+        size_t r = queues[victim].end - queues[victim].begin;
+        if (r == 0) continue;  // emptied meanwhile; look for another one.
+        end = queues[victim].end;
+        begin = end - (r + 1) / 2;
+        queues[victim].end = begin;
+      }
+      std::lock_guard<std::mutex> lock(queues[self].mutex);
+      queues[self].begin = begin;
+      queues[self].end = end;
+      return true;
+    }
+  };
+
+  auto worker = [&](int self) {
+    size_t index;
+    while (!failed.load(std::memory_order_relaxed)) {
+      if (!queues[self].pop(index)) {
+        if (!steal(self)) break;
+        continue;
+      }
+      try {
+        fn(index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) error = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nthreads - 1);
+  for (int t = 1; t < nthreads; t++) threads.push_back(std::thread(worker, t));
+  worker(0);
+  for (auto& th : threads) th.join();
+
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace dicom
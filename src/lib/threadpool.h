@@ -0,0 +1,32 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * threadpool.h
+ */
+
+#ifndef DICOMSDL_THREADPOOL_H__
+#define DICOMSDL_THREADPOOL_H__
+
+#include <stddef.h>
+
+#include <functional>
+
+namespace dicom {
+
+// Return number of threads to use; `nthreads` <= 0 means number of cores.
+int get_num_threads(int nthreads);
+
+// Call fn(i) for every i in [0, n) using up to `nthreads` threads.
+// Indices are split evenly into a queue per thread. A thread takes indices
+// from the front of its own queue and, when the queue is empty, steals half
+// of the remaining indices from the back of the busiest queue.
+// The first exception thrown by `fn` is rethrown after all threads finish;
+// indices not started yet are skipped in that case.
+void parallel_for(size_t n, int nthreads,
+                  const std::function<void(size_t)>& fn);
+
+}  // namespace dicom
+
+#endif  // DICOMSDL_THREADPOOL_H__
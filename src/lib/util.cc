@@ -8,6 +8,22 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef ERROR  // conflicts with LogLevel::ERROR
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif
+
 #include <string>
 #include "dicom.h"
 #include "util.h"
@@ -28,96 +44,174 @@ std::string sprint(const char * format, ...) {
   return std::string(buf);
 }
 
-void swap2(uint8_t *p, size_t size) {
-  size /= 2;
-  uint8_t c;
-  while (size--) {
-    c = p[1];
-    p[1] = p[0];
-    p[0] = c;
-    p += 2;
+// Reserved memory -------------------------------------------------------------
+
+uint8_t *reserve_memory(size_t size) {
+#ifdef _WIN32
+  return (uint8_t *)VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+  // PROT_NONE pages are not counted in commit charge even with strict
+  // overcommit; commit_memory() makes them accessible.
+  void *p = mmap(NULL, size, PROT_NONE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  return (p == MAP_FAILED ? nullptr : (uint8_t *)p);
+#endif
+}
+
+bool commit_memory(uint8_t *p, size_t size) {
+  if (size == 0) return true;
+#ifdef _WIN32
+  return VirtualAlloc(p, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+#else
+  static const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  uintptr_t start = (uintptr_t)p - (uintptr_t)p % page_size;
+  return mprotect((void *)start, (uintptr_t)p + size - start,
+                  PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void release_memory(uint8_t *p, size_t size) {
+#ifdef _WIN32
+  VirtualFree(p, 0, MEM_RELEASE);
+#else
+  munmap(p, size);
+#endif
+}
+
+// Byte swapping ---------------------------------------------------------------
+
+// Reverse bytes of `n` items of N bytes from `src` into `dst`; `dst` may be
+// `src`.
+template <int N>
+static void _swap_scalar(uint8_t *dst, const uint8_t *src, size_t n) {
+  uint8_t t[N];
+  while (n--) {
+    for (int i = 0; i < N; i++) t[i] = src[N - 1 - i];
+    for (int i = 0; i < N; i++) dst[i] = t[i];
+    src += N;
+    dst += N;
   }
 }
 
-void swap4(uint8_t *p, size_t size) {
-  size /= 4;
-  uint8_t c;
-  while (size--) {
-    c = p[3];
-    p[3] = p[0];
-    p[0] = c;
-    c = p[2];
-    p[2] = p[1];
-    p[1] = c;
-    p += 4;
+#ifdef UTIL_X86_SIMD
+// pshufb masks which reverse bytes of 2, 4 and 8 bytes items.
+static const uint8_t swap_masks[3][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}};
+
+// Shuffle bytes of each 16 bytes from `src` into `dst` with `mask` while
+// whole 16 bytes are left in `size`. Return number of bytes done.
+typedef size_t (*swap_kernel_t)(uint8_t *dst, const uint8_t *src,
+                                size_t size, const uint8_t *mask);
+
+UTIL_TARGET("ssse3")
+static size_t _swap_ssse3(uint8_t *dst, const uint8_t *src, size_t size,
+                          const uint8_t *mask) {
+  __m128i m = _mm_loadu_si128((const __m128i *)mask);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, m));
   }
+  return i;
 }
 
-void swap8(uint8_t *p, size_t size) {
-  size /= 8;
-  uint8_t c;
-  while (size--) {
-    c = p[7];
-    p[7] = p[0];
-    p[0] = c;
-    c = p[6];
-    p[6] = p[1];
-    p[1] = c;
-    c = p[5];
-    p[5] = p[2];
-    p[2] = c;
-    c = p[4];
-    p[4] = p[3];
-    p[3] = c;
-    p += 8;
+UTIL_TARGET("avx2")
+static size_t _swap_avx2(uint8_t *dst, const uint8_t *src, size_t size,
+                         const uint8_t *mask) {
+  // vpshufb shuffles within each 128 bits lane; same mask for both lanes.
+  __m256i m = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i *)mask));
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    __m256i v0 = _mm256_loadu_si256((const __m256i *)(src + i));
+    __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(v0, m));
+    _mm256_storeu_si256((__m256i *)(dst + i + 32),
+                        _mm256_shuffle_epi8(v1, m));
+  }
+  for (; i + 16 <= size; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    _mm_storeu_si128((__m128i *)(dst + i),
+                     _mm_shuffle_epi8(v, _mm256_castsi256_si128(m)));
   }
+  return i;
 }
 
+bool cpu_has_avx2() {
+#if defined(__AVX2__)
+  return true;
+#elif defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) return false;
+  __cpuid(info, 1);
+  // the OS should save YMM registers (OSXSAVE and XCR0 bits 1, 2).
+  if (!(info[2] & (1 << 27)) || (_xgetbv(0) & 6) != 6) return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+bool cpu_has_ssse3() {
+#if defined(__SSSE3__)
+  return true;
+#elif defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 9)) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+// Choose a kernel for the running CPU; nullptr if none is supported.
+static swap_kernel_t _select_swap_kernel() {
+  if (cpu_has_avx2()) return _swap_avx2;
+  if (cpu_has_ssse3()) return _swap_ssse3;
+  return nullptr;
+}
+#endif  // UTIL_X86_SIMD
+
+// Reverse bytes of N bytes items in `size` bytes from `src` into `dst`; `dst`
+// may be `src`. Trailing bytes less than N are not touched.
+template <int N>
+static void _swap(uint8_t *dst, const uint8_t *src, size_t size) {
+  size_t done = 0;
+  size -= size % N;
+#ifdef UTIL_X86_SIMD
+  static const swap_kernel_t kernel = _select_swap_kernel();
+  if (kernel)
+    done = kernel(dst, src, size, swap_masks[N == 2 ? 0 : (N == 4 ? 1 : 2)]);
+#endif
+  _swap_scalar<N>(dst + done, src + done, (size - done) / N);
+}
+
+void swap2(uint8_t *p, size_t size) { _swap<2>(p, p, size); }
+void swap4(uint8_t *p, size_t size) { _swap<4>(p, p, size); }
+void swap8(uint8_t *p, size_t size) { _swap<8>(p, p, size); }
+
 void copyswap2(uint8_t *dst, uint8_t *src, size_t size) {
-  int n = size / 2;
-  while (n--) {
-    dst[0] = src[1];
-    dst[1] = src[0];
-    src += 2;
-    dst += 2;
-  }
-  n = size % 2;
-  while (n--)
-    *src++ = *dst++;
+  _swap<2>(dst, src, size);
+  size_t n = size % 2;
+  memcpy(dst + size - n, src + size - n, n);
 }
 
 void copyswap4(uint8_t *dst, uint8_t *src, size_t size) {
-  int n = size / 4;
-  while (n--) {
-    dst[0] = src[3];
-    dst[1] = src[2];
-    dst[2] = src[1];
-    dst[3] = src[0];
-    src += 4;
-    dst += 4;
-  }
-  n = size % 4;
-  while (n--)
-    *src++ = *dst++;
+  _swap<4>(dst, src, size);
+  size_t n = size % 4;
+  memcpy(dst + size - n, src + size - n, n);
 }
 
 void copyswap8(uint8_t *dst, uint8_t *src, size_t size) {
-  int n = size / 8;
-  while (n--) {
-    dst[0] = src[7];
-    dst[1] = src[6];
-    dst[2] = src[5];
-    dst[3] = src[4];
-    dst[4] = src[3];
-    dst[5] = src[2];
-    dst[6] = src[1];
-    dst[7] = src[0];
-    src += 8;
-    dst += 8;
-  }
-  n = size % 8;
-  while (n--)
-    *src++ = *dst++;
+  _swap<8>(dst, src, size);
+  size_t n = size % 8;
+  memcpy(dst + size - n, src + size - n, n);
 }
 
 int count_delimiters(const uint8_t *p, const size_t size) {
@@ -16,12 +16,34 @@
 #ifndef DICOMSDL_UTIL_H__
 #define DICOMSDL_UTIL_H__
 
+// SIMD kernels are compiled with UTIL_TARGET("ssse3") or ("avx2") and chosen
+// at run time with cpu_has_ssse3() or cpu_has_avx2() on x86.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define UTIL_X86_SIMD
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define UTIL_TARGET(isa)
+#else
+#define UTIL_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
 namespace dicom {
 
 #define MESSAGE_BUFFER_SIZE 256
 
 std::string sprint(const char *format, ...);
 
+#ifdef UTIL_X86_SIMD
+bool cpu_has_ssse3();
+bool cpu_has_avx2();
+#endif
+
+// Reverse bytes of 2, 4 or 8 bytes items in `size` bytes. pshufb kernels are
+// used on x86 CPUs with SSSE3 or AVX2. copyswap* copy trailing bytes of an
+// incomplete item as they are.
 void swap2(uint8_t *p, size_t size);
 void swap4(uint8_t *p, size_t size);
 void swap8(uint8_t *p, size_t size);
@@ -30,6 +52,17 @@ void copyswap2(uint8_t *dst, uint8_t *src, size_t size);
 void copyswap4(uint8_t *dst, uint8_t *src, size_t size);
 void copyswap8(uint8_t *dst, uint8_t *src, size_t size);
 
+// Reserve `size` bytes of address space without memory behind it; return
+// nullptr if it fails. Pages are used only after commit_memory(), so a large
+// reservation costs neither memory nor commit charge.
+uint8_t *reserve_memory(size_t size);
+// Make the pages that hold bytes [p, p + size) of a reservation readable and
+// writable; bytes of pages already committed are kept. Return false if it
+// fails.
+bool commit_memory(uint8_t *p, size_t size);
+// Release a reservation of `size` bytes at `p`.
+void release_memory(uint8_t *p, size_t size);
+
 /// Return number of '\' character in data
 int count_delimiters(const uint8_t *p, const size_t size);
 
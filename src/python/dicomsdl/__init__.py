@@ -39,7 +39,7 @@ def __dataset__getattr__(self, key):
     if tag == 0xffffffff:
         raise AttributeError("'DataSet' object has no attribute '%s'"%(key))
     else:
-        return __dataset__getitem__(self, key)
+        return __dataset__getitem__(self, tag)
 DataSet.__getattr__ = __dataset__getattr__
 
 def __dataset__setattr__(self, key, value):
@@ -47,7 +47,7 @@ def __dataset__setattr__(self, key, value):
     if tag == 0xffffffff:
         raise AttributeError("'DataSet' object has no attribute '%s'"%(key))
     else:
-        return __dataset__setitem__(self, key, value)
+        return __dataset__setitem__(self, tag, value)
 DataSet.__setattr__ = __dataset__setattr__
 
 
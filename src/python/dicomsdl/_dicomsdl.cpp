@@ -6,6 +6,8 @@
  * _dicomsdl.cc
  */
 
+#include <cmath>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
@@ -46,10 +48,39 @@ PYBIND11_MODULE(_dicomsdl, m) {
   m.attr("USE_SSE2") = py::cast(false);
 #endif // __SSE2__
 
-  m.def("open_file", &open_file, "Open a DICOM file from a file.", "filename"_a,
-        "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
-  m.def("open", &open_file, "Open a DICOM file from a file.", "filename"_a,
-        "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
+  // Functions and methods that read files or decode pixels release the GIL.
+  // See the thread safety notes in dicom.h.
+
+  m.def("open_file",
+        (std::unique_ptr<DataSet>(*)(const char *, tag_t, bool, bool)) &
+            open_file,
+        py::call_guard<py::gil_scoped_release>(),
+        "Open a DICOM file from a file.", "filename"_a,
+        "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+        "use_mmap"_a = false);
+  m.def("open_file",
+        (std::unique_ptr<DataSet>(*)(const char *, const std::vector<tag_t> &,
+                                     bool, bool)) &
+            open_file,
+        py::call_guard<py::gil_scoped_release>(),
+        "Open a DICOM file, loading only data elements with tags.",
+        "filename"_a, "tags"_a, "keep_on_error"_a = false,
+        "use_mmap"_a = false);
+  m.def("open",
+        (std::unique_ptr<DataSet>(*)(const char *, tag_t, bool, bool)) &
+            open_file,
+        py::call_guard<py::gil_scoped_release>(),
+        "Open a DICOM file from a file.", "filename"_a,
+        "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+        "use_mmap"_a = false);
+  m.def("open",
+        (std::unique_ptr<DataSet>(*)(const char *, const std::vector<tag_t> &,
+                                     bool, bool)) &
+            open_file,
+        py::call_guard<py::gil_scoped_release>(),
+        "Open a DICOM file, loading only data elements with tags.",
+        "filename"_a, "tags"_a, "keep_on_error"_a = false,
+        "use_mmap"_a = false);
   m.def(
       "open_memory",
       [](py::bytes data, bool copy_data = true, tag_t load_until = 0xffffffff,
@@ -59,11 +90,55 @@ PYBIND11_MODULE(_dicomsdl, m) {
         if (PYBIND11_BYTES_AS_STRING_AND_SIZE(data.ptr(), &buffer, &length))
           py::pybind11_fail("Unable to extract bytes contents!");
 
-        return open_memory((uint8_t *)buffer, (size_t)length, copy_data,
-                           load_until, keep_on_error);
+        std::unique_ptr<DataSet> dset;
+        {
+          py::gil_scoped_release release;
+          dset = open_memory((uint8_t *)buffer, (size_t)length, copy_data,
+                             load_until, keep_on_error);
+        }
+
+        // DataSet refers to `data` if it is not copied; keep `data` alive.
+        py::object obj = py::cast(std::move(dset));
+        if (!copy_data) py::detail::keep_alive_impl(obj, data);
+        return obj;
       },
       "Open a DICOM file from a string.", "data"_a, "copy_data"_a = true,
       "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
+  m.def(
+      "open_files",
+      [](const std::vector<std::string> &filenames,
+         tag_t load_until = 0xffffffff, int nthreads = 0,
+         bool keep_on_error = false) {
+        std::vector<std::unique_ptr<DataSet>> dsets;
+        std::vector<std::string> errors;
+        {
+          py::gil_scoped_release release;
+          dsets = open_files(filenames, load_until, nthreads, keep_on_error,
+                             &errors);
+        }
+        return py::make_tuple(py::cast(std::move(dsets)), py::cast(errors));
+      },
+      "Open DICOM files in parallel.\n"
+      "Return a tuple (list of DataSet, list of error messages) in the order\n"
+      "of filenames. A DataSet is None if its file failed to load and\n"
+      "keep_on_error is False; an error message is '' if there is no error.",
+      "filenames"_a, "load_until"_a = 0xffffffff, "nthreads"_a = 0,
+      "keep_on_error"_a = false);
+  m.def(
+      "scan_header",
+      [](const char *filename, tag_t stop_tag = 0x7fe00010,
+         size_t max_bytes = 0) {
+        size_t bytes_read = 0;
+        std::unique_ptr<DataSet> dset;
+        {
+          py::gil_scoped_release release;
+          dset = scan_header(filename, stop_tag, max_bytes, &bytes_read);
+        }
+        return py::make_tuple(std::move(dset), bytes_read);
+      },
+      "Read data elements before stop_tag without reading large values.\n"
+      "Return a tuple (DataSet, number of bytes read from the file).",
+      "filename"_a, "stop_tag"_a = 0x7fe00010, "max_bytes"_a = 0);
 
   // Types --------------------------------------------------------------------
 
@@ -201,7 +276,8 @@ PYBIND11_MODULE(_dicomsdl, m) {
                   "Get Tag's Keyword. e.g. 0x00080008 -> 'ImageType'")
       .def_static("name", &TAG::name,
                   "Get Tag's Name. e.g. 0x00080008 -> 'Image Type'")
-      .def_static("from_keyword", &TAG::from_keyword,
+      .def_static("from_keyword",
+                  (tag_t(*)(const char *)) & TAG::from_keyword,
                   "Get a Tag from Keyword. e.g. 'ImageType' -> 0x00080008");
 
   py::class_<CHARSET> charset(m, "CHARSET");
@@ -347,12 +423,58 @@ PYBIND11_MODULE(_dicomsdl, m) {
         }
 
         uint8_t *data = (uint8_t *)buf.ptr;
-        int rows, cols, rowstrides;
+        int rows, rowstrides;
         rows = buf.shape[0];
-        cols = buf.shape[1];
         rowstrides = buf.strides[0];
-        pixseq.copyDecodedFrameData(index, data, rowstrides * cols, rowstrides);
-      });
+        py::gil_scoped_release release;
+        pixseq.copyDecodedFrameData(index, data, rowstrides * rows, rowstrides);
+      })
+      .def(
+          "decodeFrames",
+          [](PixelSequence &pixseq, size_t start, long count, int nthreads) {
+            DataSet *ds = pixseq.rootDataSet();
+            long rows = ds->getDataElement(0x00280010)->toLong();
+            long cols = ds->getDataElement(0x00280011)->toLong();
+            long ncomps = ds->getDataElement(0x00280002)->toLong(1);
+            int bitsalloc = ds->getDataElement(0x00280100)->toLong();
+            bool sgnd = ds->getDataElement(0x00280103)->toLong() != 0;
+
+            size_t nframes = pixseq.numberOfFrames();
+            if (count < 0) count = (start < nframes ? nframes - start : 0);
+
+            py::dtype dtype;
+            int bytesalloc;
+            if (bitsalloc <= 8) {
+              dtype = py::dtype::of<uint8_t>();
+              bytesalloc = 1;
+            } else if (bitsalloc <= 16) {
+              dtype = sgnd ? py::dtype::of<int16_t>() : py::dtype::of<uint16_t>();
+              bytesalloc = 2;
+            } else {
+              char errmsg[128];
+              snprintf(errmsg, 128, "cannot decode frames with BitsAllocated %d",
+                       bitsalloc);
+              throw std::runtime_error(errmsg);
+            }
+
+            std::vector<py::ssize_t> shape = {count, rows, cols};
+            if (ncomps > 1) shape.push_back(ncomps);
+            py::array outarr(dtype, shape);
+
+            uint8_t *data = (uint8_t *)outarr.mutable_data();
+            int rowstep = int(cols * ncomps * bytesalloc);
+            {
+              py::gil_scoped_release release;
+              pixseq.decodeFrames(start, count, data,
+                                  (size_t)count * rows * rowstep, rowstep,
+                                  nthreads);
+            }
+            return outarr;
+          },
+          "Decode frames [start, start + count) in parallel and return an "
+          "array\nof shape (count, rows, cols) or (count, rows, cols, "
+          "samples).\ncount < 0 decodes all frames from start.",
+          "start"_a = 0, "count"_a = -1, "nthreads"_a = 0);
 
   // class DataElement ---------------------------------------------------------
 
@@ -400,8 +522,7 @@ PYBIND11_MODULE(_dicomsdl, m) {
 
   // class DataSet -------------------------------------------------------------
 
-  typedef Iterator<std::map<tag_t, std::unique_ptr<DataElement>>>
-      DataElementIterator;
+  typedef Iterator<DataSet::element_table_t> DataElementIterator;
   py::class_<DataElementIterator>(m, "DataElementIterator")
       .def("__iter__",
            [](DataElementIterator &s) -> DataElementIterator & { return s; })
@@ -442,15 +563,26 @@ PYBIND11_MODULE(_dicomsdl, m) {
            (void (DataSet::*)(tag_t)) & DataSet::removeDataElement)
       .def("removeDataElement",
            (void (DataSet::*)(const char *)) & DataSet::removeDataElement)
-      .def("attachToFile", &DataSet::attachToFile)
+      .def("attachToFile", &DataSet::attachToFile, "filename"_a,
+           "use_mmap"_a = false)
       .def("attachToMemory", &DataSet::attachToMemory)
       .def("getSpecificCharset", &DataSet::getSpecificCharset, "index"_a = 0)
       .def("setSpecificCharset", &DataSet::setSpecificCharset)
-      .def("dump", &DataSet::dump, "max_length"_a = 120)
-      .def("saveToFile", &DataSet::saveToFile)
-      .def("save", &DataSet::saveToFile)
+      .def("dump", &DataSet::dump, py::call_guard<py::gil_scoped_release>(),
+           "max_length"_a = 120)
+      .def("saveToFile", &DataSet::saveToFile,
+           py::call_guard<py::gil_scoped_release>())
+      .def("save", &DataSet::saveToFile,
+           py::call_guard<py::gil_scoped_release>())
       .def("saveToMemory",
-           [](DataSet &ds) { return py::bytes(ds.saveToMemory()); })
+           [](DataSet &ds) {
+             std::string s;
+             {
+               py::gil_scoped_release release;
+               s = ds.saveToMemory();
+             }
+             return py::bytes(s);
+           })
       .def("close", &DataSet::close)
       .def("getTransferSyntax", &DataSet::getTransferSyntax)
       .def(
@@ -529,6 +661,7 @@ PYBIND11_MODULE(_dicomsdl, m) {
                throw std::runtime_error(errmsg);
              }
 
+             py::gil_scoped_release release;
              if (samplesperpixel == 1) {  // gray image ---------------------
                ds.copyFrameData(index, (uint8_t *)outbuf.ptr,
                                 outbuf_rows * outbuf.strides[0],
@@ -644,27 +777,31 @@ PYBIND11_MODULE(_dicomsdl, m) {
                // check in SharedFunctionalGroupsSequence
                char buf[128];
                snprintf(buf, 128, "52009229.0.%08x.0.%08x", macro_tag, tag);
-               de = ds.getDataElement(buf);
+               de = TagPath(buf).find(&ds);
                if (de->isValid()) {
                  return py::cast(de->toDouble());
                }
 
                // check in PerFrameFunctionalGroupsSequence
-               Sequence *seq = ds.getDataElement(0x52009230)->toSequence();
-               if (seq == nullptr) {
+               if (!ds.getDataElement(0x52009230)->isValid()) {
                  return objnone;
                }
 
-               auto li = py::list();
-               int seqsize = seq->size();
-               for (int i = 0; i < seqsize; ++i) {
-                 snprintf(buf, 128, "%08x.0.%08x", macro_tag, tag);
-                 de = (*seq)[i]->getDataElement(buf);
+               // one pass over all frames
+               snprintf(buf, 128, "52009230.*.%08x.0.%08x", macro_tag, tag);
+               std::vector<DataElement *> elements;
+               TagPath(buf).forEach(&ds, [&elements](DataElement *el) {
+                 elements.push_back(el);
+               });
+
+               py::list li(elements.size());
+               for (size_t i = 0; i < elements.size(); ++i) {
+                 de = elements[i];
                  if (de->isValid() && de->length() > 0) {
-                   li.append(py::cast(de->toDouble()));
+                   li[i] = py::cast(de->toDouble());
                  } else {
                    // data element is not valid or has empty value.
-                   li.append(objnone);
+                   li[i] = objnone;
                  }
                }
                return py::object(li);
@@ -738,7 +875,7 @@ PYBIND11_MODULE(_dicomsdl, m) {
   // class Sequence
   // ------------------------------------------------------------
 
-  typedef Iterator<std::vector<std::unique_ptr<DataSet>>> DataSetIter;
+  typedef Iterator<std::vector<arena_ptr<DataSet>>> DataSetIter;
 
   py::class_<DataSetIter>(m, "DataSetIter")
       .def("__iter__", [](DataSetIter &s) -> DataSetIter & { return s; })
@@ -774,6 +911,53 @@ PYBIND11_MODULE(_dicomsdl, m) {
           [](Sequence &ds, size_t index) { return ds.getDataSet(index); },
           py::return_value_policy::reference_internal);
 
+  py::class_<TagPath>(m, "TagPath")
+      .def(py::init<const char *>(), "tagstr"_a,
+           "Parse a tag string such as '52009229.0.00289110.0.00280030' once "
+           "for many DataSets.")
+      .def("find", &TagPath::find, py::return_value_policy::reference,
+           py::keep_alive<0, 2>(), "dataset"_a,
+           "Get a DataElement for the path in the dataset.")
+      .def(
+          "findAll",
+          [](TagPath &path, py::object dataset) {
+            // keep_alive<0, 2> can't be applied to a list; each element keeps
+            // the dataset alive instead.
+            py::list elements;
+            path.forEach(dataset.cast<DataSet *>(), [&](DataElement *el) {
+              py::object elem =
+                  py::cast(el, py::return_value_policy::reference);
+              py::detail::keep_alive_impl(elem, dataset);
+              elements.append(elem);
+            });
+            return elements;
+          },
+          "dataset"_a,
+          "Get DataElements for a path with '*' for all items, e.g.\n"
+          "'52009230.*.00289145.0.00281052'. An invalid DataElement is "
+          "returned\nfor an item without the element.")
+      .def(
+          "toDoubleVector",
+          [](TagPath &path, DataSet *dataset, double default_value) {
+            std::vector<double> values;
+            path.toDoubleVector(dataset, values, default_value);
+            return py::array_t<double>(values.size(), values.data());
+          },
+          "dataset"_a, "default_value"_a = std::nan(""),
+          "Get values of DataElements for the path as a numpy array; "
+          "default_value\nfor missing or empty elements.")
+      .def(
+          "toLongVector",
+          [](TagPath &path, DataSet *dataset, long default_value) {
+            std::vector<long> values;
+            path.toLongVector(dataset, values, default_value);
+            return py::array_t<long>(values.size(), values.data());
+          },
+          "dataset"_a, "default_value"_a = 0,
+          "Get values of DataElements for the path as a numpy array; "
+          "default_value\nfor missing or empty elements.")
+      .def("__str__", &TagPath::str);
+
   // Exception
   // -----------------------------------------------------------------
 
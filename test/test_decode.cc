@@ -0,0 +1,101 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_decode.cc
+ *
+ * Decode frames in parallel and compare them with frames decoded one by one.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+#define NUM_FRAMES 6
+
+// Frames of a multi-frame image made from the single frame of CT2_JLSN;
+// frame k is frame 0 rolled down by 7 * k rows.
+static int test_decode_frames(const std::string& filename) {
+  auto dset = open_file(filename.c_str());
+  PixelSequence* pixseq = dset->getDataElement(0x7fe00010)->toPixelSequence();
+  CHECK(pixseq && pixseq->numberOfFrames() == 1);
+  int rows = dset->getDataElement(0x00280010)->toLong();
+  int cols = dset->getDataElement(0x00280011)->toLong();
+  int rowstep = cols * 2;
+  size_t framesize = (size_t)rows * rowstep;
+
+  std::vector<uint8_t> image(framesize);
+  pixseq->copyDecodedFrameData(0, image.data(), (int)framesize, rowstep);
+  std::vector<uint8_t> rolled(framesize);
+  for (int k = 1; k < NUM_FRAMES; k++) {
+    for (int r = 0; r < rows; r++)
+      memcpy(&rolled[(size_t)((r + 7 * k) % rows) * rowstep],
+             &image[(size_t)r * rowstep], rowstep);
+    pixseq->addPixelFrame();
+    pixseq->encodeFrameData(k, rolled.data(), framesize, rowstep);
+  }
+
+  std::vector<uint8_t> serial(framesize * NUM_FRAMES);
+  for (int k = 0; k < NUM_FRAMES; k++)
+    pixseq->copyDecodedFrameData(k, &serial[framesize * k], (int)framesize,
+                                 rowstep);
+  CHECK(memcmp(&serial[0], &serial[framesize], framesize) != 0);
+
+  for (int nthreads : {1, 4}) {
+    std::vector<uint8_t> decoded(framesize * NUM_FRAMES);
+    pixseq->decodeFrames(0, NUM_FRAMES, decoded.data(), decoded.size(),
+                         rowstep, nthreads);
+    CHECK(decoded == serial);
+
+    // frames 2, 3 and 4 only.
+    std::vector<uint8_t> part(framesize * 3);
+    pixseq->decodeFrames(2, 3, part.data(), part.size(), rowstep, nthreads);
+    CHECK(memcmp(part.data(), &serial[framesize * 2], part.size()) == 0);
+  }
+
+  // a broken frame is reported in `errors`, or thrown.
+  pixseq->addPixelFrame();
+  std::vector<uint8_t> garbage(1000, 0x5a);
+  pixseq->setEncodedFrameData(NUM_FRAMES, garbage.data(), garbage.size());
+
+  std::vector<uint8_t> decoded(framesize * (NUM_FRAMES + 1));
+  std::vector<std::string> errors;
+  pixseq->decodeFrames(0, NUM_FRAMES + 1, decoded.data(), decoded.size(),
+                       rowstep, 4, &errors);
+  CHECK(errors.size() == NUM_FRAMES + 1);
+  for (int k = 0; k < NUM_FRAMES; k++) CHECK(errors[k].empty());
+  CHECK(!errors[NUM_FRAMES].empty());
+  CHECK(memcmp(decoded.data(), serial.data(), serial.size()) == 0);
+
+  bool thrown = false;
+  try {
+    pixseq->decodeFrames(0, NUM_FRAMES + 1, decoded.data(), decoded.size(),
+                         rowstep, 4);
+  } catch (DicomException&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+
+  if (test_decode_frames(srcdir + "/../tutorials/CT2_JLSN")) return 1;
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_deflate.cc
+ *
+ * Save DataSets as Deflated Explicit VR Little Endian and read them back.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+#define DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN "1.2.840.10008.1.2.1.99"
+
+static std::string read_file(const std::string& filename) {
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
+// Return 0 if elements of `dset` and `ref` are the same, except for the file
+// meta information.
+static int compare_dataset(DataSet* dset, DataSet* ref) {
+  auto it = dset->begin(), it_ref = ref->begin();
+  while (it != dset->end() && it->first < 0x00030000) ++it;
+  while (it_ref != ref->end() && it_ref->first < 0x00030000) ++it_ref;
+
+  for (; it != dset->end() && it_ref != ref->end(); ++it, ++it_ref) {
+    DataElement* de = it->second.get();
+    DataElement* de_ref = it_ref->second.get();
+    CHECK(de->tag() == de_ref->tag());
+    CHECK(de->vr() == de_ref->vr());
+    if (de->vr() == VR::SQ) {
+      Sequence* seq = de->toSequence();
+      Sequence* seq_ref = de_ref->toSequence();
+      CHECK(seq->size() == seq_ref->size());
+      for (int i = 0; i < seq->size(); i++)
+        if (compare_dataset(seq->getDataSet(i), seq_ref->getDataSet(i)))
+          return 1;
+    } else {
+      CHECK(de->length() == de_ref->length());
+      CHECK(memcmp(de->value_ptr(), de_ref->value_ptr(), de->length()) == 0);
+    }
+  }
+  CHECK(it == dset->end() && it_ref == ref->end());
+  return 0;
+}
+
+// Deflate with `nthreads` threads; a value of `extra_bytes` bytes spans
+// several blocks that are deflated in parallel.
+static int test_round_trip(const std::string& srcname, int nthreads,
+                           size_t extra_bytes) {
+  const char* filename = "test_deflate.dcm";
+  auto ref = open_file(srcname.c_str());
+  ref->getDataElement(0x00020010)->fromBytes(DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN);
+  if (extra_bytes) {
+    // runs and text, compressible but not trivially.
+    std::string doc(extra_bytes, '\0');
+    for (size_t i = 0; i < doc.size(); i++)
+      doc[i] = ((i / 1000) % 3 ? "ABCDEFGHIJ"[(i * 7 + i / 13) % 10] : ' ');
+    ref->addDataElement(0x00420011, VR::OB)->fromBytes(doc);
+  }
+  Config::setInteger("DEFLATE_THREADS", nthreads);
+  ref->saveToFile(filename);
+  Config::setInteger("DEFLATE_THREADS", 0);
+
+  auto dset = open_file(filename);
+  CHECK(dset->getDataElement(0x00020010)->toBytes() ==
+        DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN);
+  if (compare_dataset(dset.get(), ref.get())) return 1;
+  dset.reset();
+
+  remove(filename);
+  return 0;
+}
+
+// A deflated file that is cut in the middle is an error.
+static int test_truncated(const std::string& srcname) {
+  const char* filename = "test_deflate.dcm";
+  auto ref = open_file(srcname.c_str());
+  ref->getDataElement(0x00020010)->fromBytes(DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN);
+  ref->saveToFile(filename);
+
+  std::string data = read_file(filename);
+  std::ofstream(filename, std::ios::binary) << data.substr(0, data.size() / 2);
+
+  bool thrown = false;
+  try {
+    open_file(filename);
+  } catch (DicomException&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+
+  remove(filename);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+  std::string srcname = srcdir + "/test_le.dcm";
+
+  for (int nthreads : {1, 4}) {
+    if (test_round_trip(srcname, nthreads, 0)) return 1;
+    // larger than a 128 KB block.
+    if (test_round_trip(srcname, nthreads, 1000000)) return 1;
+  }
+  if (test_truncated(srcname)) return 1;
+  printf("ok\n");
+  return 0;
+}
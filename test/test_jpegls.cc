@@ -0,0 +1,158 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_jpegls.cc
+ *
+ * Encode images with JPEG-LS and decode them back.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "dicom.h"
+#include "imagecodec.h"
+
+using namespace dicom;
+
+#define JPEGLS_LOSSLESS "1.2.840.10008.1.2.4.80"
+#define JPEGLS_NEAR_LOSSLESS "1.2.840.10008.1.2.4.81"
+
+static int sample(const std::vector<uint8_t> &image, size_t offset,
+                  int bytes) {
+  return (bytes == 2 ? image[offset] | image[offset + 1] << 8 : image[offset]);
+}
+
+// Encode a `rows` x `cols` image of `ncomps` samples of `prec` bits, in
+// planes if `planar`, decode it and compare; return 0 if no sample differs by
+// more than `near`.
+static int round_trip(const char *tsuid, int rows, int cols, int prec,
+                      int ncomps, bool planar, int near) {
+  int bytes = (prec > 8 ? 2 : 1);
+  int rowbytes = cols * bytes * (planar ? 1 : ncomps);
+  int nplanes = (planar ? ncomps : 1);
+  std::vector<uint8_t> image((size_t)rows * rowbytes * nplanes);
+  for (size_t i = 0; i < image.size() / bytes; i++) {
+    int v = (((int)(i % 97) * 31 + (int)(i / 211) * 7) ^ (rand() & 15)) &
+            ((1 << prec) - 1);
+    image[i * bytes] = (uint8_t)v;
+    if (bytes == 2) image[i * bytes + 1] = (uint8_t)(v >> 8);
+  }
+
+  imagecontainer ic;
+  memset(&ic, 0, sizeof(ic));
+  ic.data = (char *)image.data();
+  ic.datasize = (long)image.size();
+  ic.rowstep = rowbytes;
+  ic.rows = rows;
+  ic.cols = cols;
+  ic.prec = prec;
+  ic.ncomps = ncomps;
+  snprintf(ic.args, sizeof(ic.args), "near=%d;planar=%d", near, planar);
+
+  char *encoded;
+  long encoded_size;
+  free_memory_fnptr free_memory;
+  if (encode_pixeldata(tsuid, &ic, &encoded, &encoded_size, &free_memory) !=
+      DICOMSDL_CODEC_OK) {
+    fprintf(stderr, "encode %dx%d prec %d ncomps %d planar %d: %s\n", rows,
+            cols, prec, ncomps, planar, ic.info);
+    return 1;
+  }
+
+  // decoded samples are interleaved.
+  int outrowbytes = cols * bytes * ncomps;
+  std::vector<uint8_t> out((size_t)rows * outrowbytes);
+  imagecontainer dc = ic;
+  dc.args[0] = '\0';
+  dc.data = (char *)out.data();
+  dc.datasize = (long)out.size();
+  dc.rowstep = outrowbytes;
+  DICOMSDL_CODEC_RESULT res =
+      decode_pixeldata(tsuid, encoded, encoded_size, &dc);
+  free_memory(encoded);
+  if (res != DICOMSDL_CODEC_OK) {
+    fprintf(stderr, "decode %dx%d prec %d ncomps %d planar %d: %s\n", rows,
+            cols, prec, ncomps, planar, dc.info);
+    return 1;
+  }
+  if (dc.lossy != (near > 0 ? 1 : 0)) {
+    fprintf(stderr, "lossy %d for near %d\n", dc.lossy, near);
+    return 1;
+  }
+
+  for (int r = 0; r < rows; r++)
+    for (int c = 0; c < cols; c++)
+      for (int k = 0; k < ncomps; k++) {
+        size_t src =
+            (planar ? ((size_t)k * rows + r) * rowbytes + c * bytes
+                    : (size_t)r * rowbytes + (c * ncomps + k) * bytes);
+        int a = sample(out, (size_t)r * outrowbytes + (c * ncomps + k) * bytes,
+                       bytes);
+        if (abs(a - sample(image, src, bytes)) > near) {
+          fprintf(stderr,
+                  "mismatch %dx%d prec %d ncomps %d planar %d near %d at "
+                  "(%d, %d)\n",
+                  rows, cols, prec, ncomps, planar, near, r, c);
+          return 1;
+        }
+      }
+  return 0;
+}
+
+// return true if encoding a 16x16 image with `args` fails.
+static bool expect_error(const char *tsuid, int prec, int ncomps,
+                         const char *args) {
+  std::vector<uint8_t> image(16 * 16 * ncomps * (prec > 8 ? 2 : 1));
+  imagecontainer ic;
+  memset(&ic, 0, sizeof(ic));
+  ic.data = (char *)image.data();
+  ic.datasize = (long)image.size();
+  ic.rowstep = (int)image.size() / 16;
+  ic.rows = ic.cols = 16;
+  ic.prec = prec;
+  ic.ncomps = ncomps;
+  strcpy(ic.args, args);
+
+  char *encoded;
+  long encoded_size;
+  free_memory_fnptr free_memory;
+  if (encode_pixeldata(tsuid, &ic, &encoded, &encoded_size, &free_memory) ==
+      DICOMSDL_CODEC_OK) {
+    free_memory(encoded);
+    fprintf(stderr, "prec %d ncomps %d with \"%s\" is encoded\n", prec,
+            ncomps, args);
+    return false;
+  }
+  return true;
+}
+
+int main() {
+  int failed = 0;
+
+  for (int prec : {8, 12, 16})
+    for (int ncomps : {1, 3})
+      for (int cols : {1, 9, 100}) {
+        failed += round_trip(JPEGLS_LOSSLESS, 17, cols, prec, ncomps, false, 0);
+        failed += round_trip(JPEGLS_NEAR_LOSSLESS, 17, cols, prec, ncomps,
+                             false, 3);
+      }
+  for (int prec : {6, 8, 12}) {
+    failed += round_trip(JPEGLS_LOSSLESS, 17, 9, prec, 3, true, 0);
+    failed += round_trip(JPEGLS_NEAR_LOSSLESS, 17, 9, prec, 3, true, 2);
+  }
+  failed += round_trip(JPEGLS_LOSSLESS, 512, 512, 16, 1, false, 0);
+
+  // planar components of more than 12 bits and near-lossless with the
+  // lossless transfer syntax are refused.
+  failed += !expect_error(JPEGLS_LOSSLESS, 16, 3, "planar=1");
+  failed += !expect_error(JPEGLS_LOSSLESS, 8, 1, "near=2");
+
+  if (failed) return 1;
+  printf("ok\n");
+  return 0;
+}
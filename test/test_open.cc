@@ -0,0 +1,168 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_open.cc
+ *
+ * Open files in different ways and compare them with open_file().
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+static std::string read_file(const std::string& filename) {
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
+// Return 0 if elements of `dset` and `ref` are the same.
+static int compare_dataset(DataSet* dset, DataSet* ref) {
+  auto it = dset->begin(), it_ref = ref->begin();
+  for (; it != dset->end() && it_ref != ref->end(); ++it, ++it_ref) {
+    DataElement* de = it->second.get();
+    DataElement* de_ref = it_ref->second.get();
+    CHECK(de->tag() == de_ref->tag());
+    CHECK(de->vr() == de_ref->vr());
+    CHECK(de->length() == de_ref->length());
+    if (de->vr() == VR::SQ) {
+      Sequence* seq = de->toSequence();
+      Sequence* seq_ref = de_ref->toSequence();
+      CHECK(seq->size() == seq_ref->size());
+      for (int i = 0; i < seq->size(); i++)
+        if (compare_dataset(seq->getDataSet(i), seq_ref->getDataSet(i)))
+          return 1;
+    } else if (de->vr() == VR::PIXSEQ) {
+      PixelSequence* pixseq = de->toPixelSequence();
+      PixelSequence* pixseq_ref = de_ref->toPixelSequence();
+      CHECK(pixseq->numberOfFrames() == pixseq_ref->numberOfFrames());
+      for (size_t i = 0; i < pixseq->numberOfFrames(); i++) {
+        Buffer<uint8_t> frame = pixseq->encodedFrameData(i);
+        Buffer<uint8_t> frame_ref = pixseq_ref->encodedFrameData(i);
+        CHECK(frame.size == frame_ref.size);
+        CHECK(memcmp(frame.data, frame_ref.data, frame.size) == 0);
+      }
+    } else {
+      CHECK(memcmp(de->value_ptr(), de_ref->value_ptr(), de->length()) == 0);
+    }
+  }
+  CHECK(it == dset->end() && it_ref == ref->end());
+  return 0;
+}
+
+// A memory mapped file gives the same DataSet as a file that is read.
+static int test_mmap(const std::string& filename) {
+  auto ref = open_file(filename.c_str());
+  auto dset = open_file(filename.c_str(), 0xffffffff, false, true);
+  if (compare_dataset(dset.get(), ref.get())) return 1;
+
+  // elements after `load_until` are loaded on access.
+  dset = open_file(filename.c_str(), 0x00080020, false, true);
+  CHECK(dset->getDataElement(0x00280010)->toLong() ==
+        ref->getDataElement(0x00280010)->toLong());
+  return 0;
+}
+
+// Only the given tags, and tags needed to read them, are loaded.
+static int test_load_tags(const std::string& filename) {
+  auto ref = open_file(filename.c_str());
+  // unsorted; (0008,2112) is a sequence.
+  std::vector<tag_t> tags = {0x00280011, 0x00082112, 0x00280010, 0x00100020};
+  auto dset = open_file(filename.c_str(), tags);
+
+  for (auto& kv : *dset) {
+    tag_t tag = kv.first;
+    CHECK(std::find(tags.begin(), tags.end(), tag) != tags.end() ||
+          (tag >> 16) == 0x0002 || tag == 0x00080005 || tag == 0x00280100);
+  }
+  for (tag_t tag : tags) {
+    DataElement* de = dset->getDataElement(tag);
+    DataElement* de_ref = ref->getDataElement(tag);
+    CHECK(de->isValid() == de_ref->isValid());
+    CHECK(de->length() == de_ref->length());
+  }
+  CHECK(dset->getDataElement(0x00280010)->toLong() ==
+        ref->getDataElement(0x00280010)->toLong());
+  Sequence* seq_ref = ref->getDataElement(0x00082112)->toSequence();
+  if (seq_ref) {
+    Sequence* seq = dset->getDataElement(0x00082112)->toSequence();
+    CHECK(seq && seq->size() == seq_ref->size());
+    for (int i = 0; i < seq->size(); i++)
+      if (compare_dataset(seq->getDataSet(i), seq_ref->getDataSet(i)))
+        return 1;
+  }
+
+  // other elements are not there, even after the largest tag.
+  CHECK(!dset->getDataElement(0x00080060)->isValid());
+  CHECK(!dset->getDataElement(0x7fe00010)->isValid());
+  return 0;
+}
+
+// Files opened in parallel are in the order of the names; a file that fails
+// gives nullptr or a partial DataSet and an error message.
+static int test_open_files(const std::vector<std::string>& filenames) {
+  const char* broken = "test_open.dcm";
+  std::string data = read_file(filenames[0]);
+  std::ofstream(broken, std::ios::binary) << data.substr(0, data.size() - 10);
+
+  std::vector<std::string> names(filenames);
+  names.push_back("no such file");
+  names.push_back(broken);
+
+  for (bool keep_on_error : {false, true}) {
+    std::vector<std::string> errors;
+    auto dsets = open_files(names, 0xffffffff, 4, keep_on_error, &errors);
+    CHECK(dsets.size() == names.size() && errors.size() == names.size());
+    for (size_t i = 0; i < filenames.size(); i++) {
+      CHECK(dsets[i] && errors[i].empty());
+      auto ref = open_file(filenames[i].c_str());
+      if (compare_dataset(dsets[i].get(), ref.get())) return 1;
+    }
+    // as open_file(), keep_on_error keeps even an empty DataSet.
+    size_t n = filenames.size();
+    CHECK(!errors[n].empty() && !errors[n + 1].empty());
+    if (keep_on_error) {
+      CHECK(dsets[n] && dsets[n]->begin() == dsets[n]->end());
+      CHECK(dsets[n + 1]);
+      CHECK(dsets[n + 1]->getDataElement(0x00280010)->toLong() == 4);
+    } else {
+      CHECK(!dsets[n] && !dsets[n + 1]);
+    }
+  }
+
+  remove(broken);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+  const std::vector<std::string> filenames = {
+      srcdir + "/test_le.dcm", srcdir + "/test_be.dcm",
+      srcdir + "/../tutorials/CT2_JLSN"};
+
+  for (const std::string& filename : filenames)
+    if (test_mmap(filename)) return 1;
+  for (const std::string& filename : filenames)
+    if (test_load_tags(filename)) return 1;
+  if (test_open_files(filenames)) return 1;
+  printf("ok\n");
+  return 0;
+}
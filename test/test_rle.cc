@@ -0,0 +1,108 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_rle.cc
+ *
+ * Encode images with RLE Lossless and decode them back.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "dicom.h"
+#include "imagecodec.h"
+
+using namespace dicom;
+
+#define RLE_LOSSLESS "1.2.840.10008.1.2.5"
+
+// Encode a `rows` x `cols` image of `ncomps` samples of `prec` bits, decode
+// it and compare; return 0 if they are the same.
+static int round_trip(int rows, int cols, int prec, int ncomps, bool planar) {
+  int bytes = (prec > 16 ? 4 : (prec > 8 ? 2 : 1));
+  int rowbytes = cols * bytes * (planar ? 1 : ncomps);
+  std::vector<uint8_t> image((size_t)rows * rowbytes * (planar ? ncomps : 1));
+  // runs and literals
+  for (size_t i = 0; i < image.size(); i++)
+    image[i] = ((i / 37) % 2 ? (uint8_t)rand() : (uint8_t)(i / 50));
+
+  imagecontainer ic;
+  memset(&ic, 0, sizeof(ic));
+  ic.data = (char *)image.data();
+  ic.datasize = (long)image.size();
+  ic.rowstep = rowbytes;
+  ic.rows = rows;
+  ic.cols = cols;
+  ic.prec = prec;
+  ic.ncomps = ncomps;
+  if (planar) strcpy(ic.args, "planar=1");
+
+  char *encoded;
+  long encoded_size;
+  free_memory_fnptr free_memory;
+  if (encode_pixeldata(RLE_LOSSLESS, &ic, &encoded, &encoded_size,
+                       &free_memory) != DICOMSDL_CODEC_OK) {
+    fprintf(stderr, "encode %dx%d prec %d ncomps %d: %s\n", rows, cols, prec,
+            ncomps, ic.info);
+    return 1;
+  }
+
+  // decoded samples are interleaved.
+  int outrowbytes = cols * bytes * ncomps;
+  std::vector<uint8_t> out((size_t)rows * outrowbytes);
+  imagecontainer dc = ic;
+  dc.args[0] = '\0';
+  dc.data = (char *)out.data();
+  dc.datasize = (long)out.size();
+  dc.rowstep = outrowbytes;
+  DICOMSDL_CODEC_RESULT res =
+      decode_pixeldata(RLE_LOSSLESS, encoded, encoded_size, &dc);
+  free_memory(encoded);
+  if (res != DICOMSDL_CODEC_OK) {
+    fprintf(stderr, "decode %dx%d prec %d ncomps %d: %s\n", rows, cols, prec,
+            ncomps, dc.info);
+    return 1;
+  }
+
+  for (int r = 0; r < rows; r++)
+    for (int c = 0; c < cols; c++)
+      for (int k = 0; k < ncomps; k++)
+        for (int b = 0; b < bytes; b++) {
+          size_t src =
+              (planar ? ((size_t)k * rows + r) * rowbytes + c * bytes + b
+                      : (size_t)r * rowbytes + (c * ncomps + k) * bytes + b);
+          if (out[(size_t)r * outrowbytes + (c * ncomps + k) * bytes + b] !=
+              image[src]) {
+            fprintf(stderr,
+                    "mismatch %dx%d prec %d ncomps %d planar %d at (%d, %d)\n",
+                    rows, cols, prec, ncomps, planar, r, c);
+            return 1;
+          }
+        }
+  return 0;
+}
+
+int main() {
+  int failed = 0;
+
+  // 1x1 8 bit image is encoded in 66 bytes; header and one segment.
+  failed += round_trip(1, 1, 8, 1, false);
+  for (int prec : {8, 12, 16, 32})
+    for (int ncomps : {1, 3})
+      for (int cols : {1, 2, 7, 130, 300}) {
+        failed += round_trip(11, cols, prec, ncomps, false);
+        if (ncomps > 1) failed += round_trip(11, cols, prec, ncomps, true);
+      }
+  // large enough to encode segments in parallel.
+  failed += round_trip(300, 400, 16, 1, false);
+  failed += round_trip(300, 400, 8, 3, false);
+
+  if (failed) return 1;
+  printf("ok\n");
+  return 0;
+}
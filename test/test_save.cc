@@ -0,0 +1,107 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_save.cc
+ *
+ * Save a DataSet to the file it is read from.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+static std::string read_file(const std::string& filename) {
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
+static int test_save_in_place(const std::string& srcname, bool use_mmap) {
+  const char* filename = "test_save.dcm";
+  std::string original = read_file(srcname);
+  std::ofstream(filename, std::ios::binary) << original;
+  auto ref = open_file(srcname.c_str());
+
+  {
+    auto dset = open_file(filename, 0xffffffff, false, use_mmap);
+    dset->getDataElement(0x00081030)->fromString(L"EDITED IN PLACE");
+
+    // writing to the descriptor of the file itself is refused. Windows
+    // doesn't open a mapped file for writing at all.
+    FILE* fp = fopen(filename, "r+b");
+#ifndef _WIN32
+    CHECK(fp != NULL);
+#endif
+    if (fp) {
+      bool thrown = false;
+      try {
+        dset->saveToFd(fileno(fp));
+      } catch (DicomException&) {
+        thrown = true;
+      }
+      fclose(fp);
+      CHECK(thrown);
+    }
+
+    try {
+      dset->saveToFile(filename);
+    } catch (DicomException&) {
+#ifdef _WIN32
+      // a mapped file may not be replaced on Windows, but it must be kept.
+      CHECK(use_mmap);
+      dset.reset();
+      CHECK(read_file(filename) == original);
+      remove(filename);
+      return 0;
+#else
+      throw;
+#endif
+    }
+
+    // the DataSet still reads the old file.
+    DataElement* de = dset->getDataElement(0x7fe00010);
+    CHECK(de->length() == ref->getDataElement(0x7fe00010)->length());
+    CHECK(memcmp(de->value_ptr(), ref->getDataElement(0x7fe00010)->value_ptr(),
+                 de->length()) == 0);
+  }
+
+  auto dset = open_file(filename);
+  CHECK(dset->getDataElement(0x00081030)->toString() == L"EDITED IN PLACE");
+  for (tag_t tag : {0x00080018, 0x00091002, 0x00280010, 0x7fe00010}) {
+    DataElement* de = dset->getDataElement(tag);
+    DataElement* de_ref = ref->getDataElement(tag);
+    CHECK(de->isValid());
+    CHECK(de->length() == de_ref->length());
+    CHECK(memcmp(de->value_ptr(), de_ref->value_ptr(), de->length()) == 0);
+  }
+
+  dset.reset();
+  remove(filename);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+  std::string srcname = srcdir + "/test_le.dcm";
+
+  if (test_save_in_place(srcname, false)) return 1;
+  if (test_save_in_place(srcname, true)) return 1;
+  printf("ok\n");
+  return 0;
+}
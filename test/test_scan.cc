@@ -0,0 +1,109 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_scan.cc
+ *
+ * Read headers with scan_header() and compare them with open_file().
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+static std::string read_file(const std::string& filename) {
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
+static bool same_value(DataElement* de, DataElement* de_ref) {
+  return de->isValid() && de->length() == de_ref->length() &&
+         de->toBytes() == de_ref->toBytes();
+}
+
+// Pixel data is not read up to (7FE0,0010), but it is read when asked.
+static int test_stop_tag(const std::string& filename) {
+  auto ref = open_file(filename.c_str());
+  DataElement* px_ref = ref->getDataElement(0x7fe00010);
+
+  size_t bytes_read = 0;
+  auto dset = scan_header(filename.c_str(), 0x7fe00010, 0, &bytes_read);
+  CHECK(bytes_read <= px_ref->offset());
+  CHECK(same_value(dset->getDataElement(0x00280010),
+                   ref->getDataElement(0x00280010)));
+  CHECK(same_value(dset->getDataElement(0x7fe00010), px_ref));
+  return 0;
+}
+
+// An element cut by `max_bytes` is the last one, and its value is read in
+// full when it is accessed.
+static int test_cut_value(const std::string& filename) {
+  auto ref = open_file(filename.c_str());
+  DataElement* px_ref = ref->getDataElement(0x7fe00010);
+  size_t max_bytes = px_ref->offset() + 100;
+
+  size_t bytes_read = 0;
+  auto dset = scan_header(filename.c_str(), 0xffffffff, max_bytes, &bytes_read);
+  CHECK(bytes_read <= max_bytes);
+  CHECK(same_value(dset->getDataElement(0x00280011),
+                   ref->getDataElement(0x00280011)));
+  CHECK(same_value(dset->getDataElement(0x7fe00010), px_ref));
+  CHECK(!dset->getDataElement(0xfffcfffc)->isValid());
+  return 0;
+}
+
+// A header cut by `max_bytes` is returned partially, but a broken element
+// before `max_bytes` is an error.
+static int test_broken_element(const std::string& srcname) {
+  const char* filename = "test_scan.dcm";
+  auto ref = open_file(srcname.c_str());
+  DataElement* de_ref = ref->getDataElement(0x00080016);
+  size_t offset = de_ref->offset();
+
+  // make the length of (0008,0016) longer than the file.
+  std::string data = read_file(srcname);
+  data[offset - 2] = data[offset - 1] = (char)0xff;
+  std::ofstream(filename, std::ios::binary) << data;
+
+  bool thrown = false;
+  try {
+    scan_header(filename, 0x7fe00010, offset + 0x100);
+  } catch (DicomException&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+
+  auto dset = scan_header(filename, 0x7fe00010, offset - 8);
+  CHECK(same_value(dset->getDataElement(0x00080005),
+                   ref->getDataElement(0x00080005)));
+  CHECK(!dset->getDataElement(0x00080016)->isValid());
+
+  remove(filename);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+
+  if (test_stop_tag(srcdir + "/../tutorials/CT1_UNC")) return 1;
+  if (test_cut_value(srcdir + "/../tutorials/CT1_UNC")) return 1;
+  if (test_broken_element(srcdir + "/test_le.dcm")) return 1;
+  printf("ok\n");
+  return 0;
+}
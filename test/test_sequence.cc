@@ -0,0 +1,129 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_sequence.cc
+ *
+ * Read sequences whose items are parsed on first access.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+#define NUM_ITEMS 3
+
+// Save test_le.dcm with (0008,1140) of NUM_ITEMS items; item i has
+// (0020,4000) "ITEM<i>" and (0040,A170) of one item with (0008,0100) "<i>".
+static std::string make_file(const std::string& srcname,
+                             bool sq_explicit_length) {
+  auto dset = open_file(srcname.c_str());
+  Sequence* seq = dset->addDataElement(0x00081140, VR::SQ)->toSequence();
+  for (int i = 0; i < NUM_ITEMS; i++) {
+    DataSet* item = seq->addDataSet();
+    item->addDataElement(0x00204000, VR::LT)
+        ->fromString(L"ITEM" + std::to_wstring(i));
+    item->addDataElement(0x0040a170, VR::SQ)
+        ->toSequence()
+        ->addDataSet()
+        ->addDataElement(0x00080100, VR::SH)
+        ->fromString(std::to_wstring(i));
+  }
+  Config::set("SAVE_SQ_EXPLICIT_LENGTH", sq_explicit_length ? "TRUE" : "FALSE");
+  std::string data = dset->saveToMemory();
+  Config::set("SAVE_SQ_EXPLICIT_LENGTH", "TRUE");
+  return data;
+}
+
+// Items are the same as those saved, whether parsed before or after
+// elements following the sequence.
+static int test_items(const std::string& data) {
+  for (bool sequence_first : {true, false}) {
+    auto dset = open_memory((const uint8_t*)data.data(), data.size());
+    if (!sequence_first)
+      CHECK(dset->getDataElement(0x00100010)->toString() == L"SAMPLENAME");
+
+    Sequence* seq = dset->getDataElement(0x00081140)->toSequence();
+    CHECK(seq && seq->size() == NUM_ITEMS);
+    int i = 0;
+    for (auto& item : *seq) {
+      CHECK(item->getDataElement(0x00204000)->toString() ==
+            L"ITEM" + std::to_wstring(i));
+      CHECK(item->getDataElement("0040a170.0.00080100")->toString() ==
+            std::to_wstring(i));
+      i++;
+    }
+    CHECK(i == NUM_ITEMS);
+    CHECK(seq->getDataSet(NUM_ITEMS) == NULL);
+    CHECK(dset->getDataElement(0x00100010)->toString() == L"SAMPLENAME");
+  }
+  return 0;
+}
+
+// An error in the items is thrown on every access of the sequence. Elements
+// before it are read, and elements after it too if the sequence has explicit
+// length; otherwise its end can't be found and the rest of the file is taken
+// as its items.
+static int test_broken_item(std::string data, bool sq_explicit_length) {
+  // make the length of (0020,4000) of item 1 longer than the item.
+  size_t pos = data.find("ITEM1");
+  CHECK(pos != std::string::npos);
+  data[pos - 2] = data[pos - 1] = (char)0xff;
+
+  auto dset = open_memory((const uint8_t*)data.data(), data.size());
+  DataElement* de = dset->getDataElement(0x00081140);
+  CHECK(de->isValid() && de->vr() == VR::SQ);
+
+  std::string message;
+  for (int n = 0; n < 3; n++) {
+    bool thrown = false;
+    try {
+      de->toSequence()->size();
+    } catch (DicomException& e) {
+      thrown = true;
+      if (n == 0) message = e.what();
+      CHECK(message == e.what());
+    }
+    CHECK(thrown);
+  }
+  CHECK(!message.empty());
+
+  bool thrown = false;
+  try {
+    de->toSequence()->getDataSet(0);
+  } catch (DicomException&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+
+  CHECK(dset->getDataElement(0x00080016)->isValid());
+  if (sq_explicit_length)
+    CHECK(dset->getDataElement(0x00100010)->toString() == L"SAMPLENAME");
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+  std::string srcname = srcdir + "/test_le.dcm";
+
+  for (bool sq_explicit_length : {true, false}) {
+    std::string data = make_file(srcname, sq_explicit_length);
+    if (test_items(data)) return 1;
+    if (test_broken_item(data, sq_explicit_length)) return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * test_tagpath.cc
+ *
+ * Find elements with TagPath and compare them with elements found by tags.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "dicom.h"
+
+using namespace dicom;
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+            #cond);                                                  \
+    return 1;                                                        \
+  }
+
+// Paths through sequences, by tags and by keywords.
+static int test_nested(const std::string& filename) {
+  auto dset = open_file(filename.c_str());
+  DataElement* de = dset->getDataElement(0x00082112)
+                        ->toSequence()
+                        ->getDataSet(0)
+                        ->getDataElement(0x0040a170)
+                        ->toSequence()
+                        ->getDataSet(0)
+                        ->getDataElement(0x00080100);
+  CHECK(de->isValid());
+
+  TagPath path("00082112.0.0040a170.0.00080100");
+  CHECK(path.steps().size() == 3);
+  CHECK(path.find(dset.get()) == de);
+  CHECK(TagPath("(0008,2112).0.(0040,a170).0.(0008,0100)").find(dset.get()) ==
+        de);
+  CHECK(TagPath("SourceImageSequence.0.PurposeOfReferenceCodeSequence.0."
+                "CodeValue")
+            .find(dset.get()) == de);
+  CHECK(dset->getDataElement("00082112.0.0040a170.0.00080100") == de);
+
+  // no such item, and a path that ends with an item.
+  CHECK(!TagPath("00082112.1.0040a170.0.00080100").find(dset.get())->isValid());
+  CHECK(!TagPath("00082112.0").find(dset.get())->isValid());
+  return 0;
+}
+
+// A private tag is looked up in the block of its creator, which may differ
+// between DataSets.
+static int test_private_creator(const std::string& filename) {
+  auto dset = open_file(filename.c_str());
+
+  // "DICOMSDL TEST" reserves (0009,10xx) in test_le.dcm.
+  TagPath path("(0009,{DICOMSDL TEST}07)");
+  CHECK(path.steps()[0].creator == "DICOMSDL TEST");
+  CHECK(path.find(dset.get()) == dset->getDataElement(0x00091007));
+  CHECK(path.find(dset.get())->toDouble() == 12.34);
+  CHECK(TagPath("0009,{DICOMSDL TEST}22").find(dset.get()) ==
+        dset->getDataElement(0x00091022));
+  CHECK(!TagPath("(0009,{NO SUCH CREATOR}07)").find(dset.get())->isValid());
+
+  // the same creator in the second block.
+  std::unique_ptr<DataSet> other(new DataSet);
+  other->addDataElement(0x00090010, VR::LO)->fromString(L"OTHER CREATOR");
+  other->addDataElement(0x00090011, VR::LO)->fromString(L"DICOMSDL TEST");
+  other->addDataElement(0x00091007, VR::DS)->fromString(L"1.5");
+  other->addDataElement(0x00091107, VR::DS)->fromString(L"7.25");
+
+  CHECK(path.find(other.get()) == other->getDataElement(0x00091107));
+  CHECK(path.find(dset.get()) == dset->getDataElement(0x00091007));
+  CHECK(path.find(other.get())->toDouble() == 7.25);
+  return 0;
+}
+
+// Add (5200,9230) with `nitems` items to `dset`; item i has (0028,1052) of
+// i * 10 in (0028,9145) and a private (0009,xx07) of i in block 0x10 + i % 2,
+// except item 2, which has neither.
+static void add_frames(DataSet* dset, int nitems) {
+  Sequence* seq = dset->addDataElement(0x52009230, VR::SQ)->toSequence();
+  for (int i = 0; i < nitems; i++) {
+    DataSet* item = seq->addDataSet();
+    if (i == 2) continue;
+    item->addDataElement(0x00289145, VR::SQ)
+        ->toSequence()
+        ->addDataSet()
+        ->addDataElement(0x00281052, VR::DS)
+        ->fromString(std::to_wstring(i * 10));
+    tag_t block = 0x10 + i % 2;
+    if (block == 0x11)
+      item->addDataElement(0x00090010, VR::LO)->fromString(L"OTHER CREATOR");
+    item->addDataElement(0x00090000 + block, VR::LO)
+        ->fromString(L"DICOMSDL TEST");
+    item->addDataElement(0x00090007 + (block << 8), VR::IS)
+        ->fromString(std::to_wstring(i));
+  }
+}
+
+// '*' in a path gives the element of each item in order, or NullElement for
+// an item without it, the same as paths with explicit item indices.
+static int test_wildcard(DataSet* dset, int nitems) {
+  const char* paths[][2] = {
+      {"52009230.*.00289145.0.00281052", "52009230.%d.00289145.0.00281052"},
+      {"PerFrameFunctionalGroupsSequence.*.(0009,{DICOMSDL TEST}07)",
+       "PerFrameFunctionalGroupsSequence.%d.(0009,{DICOMSDL TEST}07)"}};
+
+  for (auto& p : paths) {
+    std::vector<DataElement*> found;
+    TagPath(p[0]).forEach(dset, [&](DataElement* de) { found.push_back(de); });
+    CHECK((int)found.size() == nitems);
+    for (int i = 0; i < nitems; i++) {
+      char path[100];
+      snprintf(path, sizeof(path), p[1], i);
+      DataElement* de = TagPath(path).find(dset);
+      CHECK(found[i] == de);
+      CHECK(de->isValid() == (i != 2));
+    }
+    // find() takes the first item.
+    CHECK(TagPath(p[0]).find(dset) == found[0]);
+  }
+
+  std::vector<double> values;
+  TagPath(paths[0][0]).toDoubleVector(dset, values, -1.0);
+  CHECK(values.size() == (size_t)nitems);
+  for (int i = 0; i < nitems; i++)
+    CHECK(values[i] == (i == 2 ? -1.0 : i * 10.0));
+
+  std::vector<long> longs;
+  TagPath(paths[1][0]).toLongVector(dset, longs, -1);
+  CHECK(longs.size() == (size_t)nitems);
+  for (int i = 0; i < nitems; i++) CHECK(longs[i] == (i == 2 ? -1 : i));
+
+  // a sequence without items gives nothing.
+  std::unique_ptr<DataSet> empty(new DataSet);
+  empty->addDataElement(0x52009230, VR::SQ);
+  values.clear();
+  TagPath(paths[0][0]).toDoubleVector(empty.get(), values);
+  CHECK(values.empty());
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string srcdir = (argc > 1 ? argv[1] : ".");
+
+  if (test_nested(srcdir + "/../tutorials/CT2_JLSN")) return 1;
+  if (test_private_creator(srcdir + "/test_le.dcm")) return 1;
+
+  // items built in memory, and the same items parsed from a file.
+  auto dset = open_file((srcdir + "/test_le.dcm").c_str());
+  add_frames(dset.get(), 5);
+  if (test_wildcard(dset.get(), 5)) return 1;
+  std::string data = dset->saveToMemory();
+  dset = open_memory((const uint8_t*)data.data(), data.size());
+  if (test_wildcard(dset.get(), 5)) return 1;
+  printf("ok\n");
+  return 0;
+}